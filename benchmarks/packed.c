@@ -0,0 +1,210 @@
+// Packed Animation Benchmark -------------------------------------------------------------------------------------------------
+//
+// Author: Cole Barach
+//
+// Description: Packs the frames of the animation example (see 'xy_packed.h') and reports the size of the result against the
+//   unpacked point arrays, and the cost per point of decoding it. Decoding is performed in chunks, the way the renderer
+//   fetches points while compiling a stream. The unpacked baseline is the bulk offset the renderer applies to point arrays.
+//
+//   Every frame is decoded and compared against its source before measuring, the benchmark fails on any mismatch.
+//
+//   Cycles are measured with the host's timestamp counter where available (x86), otherwise only nanoseconds are reported.
+
+// Libraries ------------------------------------------------------------------------------------------------------------------
+
+// X-Y Library
+#include <xy_packed.h>
+#include <xy_points.h>
+
+// C Standard Libraries
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Cycle Counter
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLES() __rdtsc()
+#else
+#define CYCLES() 0
+#endif
+
+// Example Models
+#include "../examples/pico/animation/models.h"
+
+// Parameters -----------------------------------------------------------------------------------------------------------------
+
+#define ITERATIONS 200                   // Number of times to decode the whole animation per method
+#define CHUNK_SIZE 32                    // Points decoded at a time, same as the renderer
+
+// Global Memory --------------------------------------------------------------------------------------------------------------
+
+uint8_t*  animation;
+xyPoint_t chunk[CHUNK_SIZE];
+uint32_t  checksum;
+
+// Benchmark Cases ------------------------------------------------------------------------------------------------------------
+
+void caseUnpacked()
+{
+    for(uint16_t frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        for(uint16_t first = 0; first < frameSizes[frame]; first += CHUNK_SIZE)
+        {
+            uint16_t count = frameSizes[frame] - first;
+            if(count > CHUNK_SIZE) count = CHUNK_SIZE;
+
+            xyPointsOffset(frames[frame] + first, chunk, count, 0, 0);
+            checksum += chunk[count - 1].x;
+        }
+    }
+}
+
+void casePacked()
+{
+    for(uint16_t frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        xyPackedReader_t reader;
+        xyPackedBegin(&reader, xyPackedFrame(animation, frame));
+
+        uint16_t count;
+        while((count = xyPackedRead(&reader, chunk, CHUNK_SIZE)) != 0) checksum += chunk[count - 1].x;
+    }
+}
+
+void casePackedOffset()
+{
+    for(uint16_t frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        xyPackedReader_t reader;
+        xyPackedBegin(&reader, xyPackedFrame(animation, frame));
+
+        uint16_t count;
+        while((count = xyPackedRead(&reader, chunk, CHUNK_SIZE)) != 0)
+        {
+            xyPointsOffset(chunk, chunk, count, 0, 0);
+            checksum += chunk[count - 1].x;
+        }
+    }
+}
+
+struct benchmarkCase
+{
+    const char* name;
+    void (*method)();
+};
+
+struct benchmarkCase cases[] =
+{
+    { "unpacked offset", caseUnpacked     },
+    { "packed decode",   casePacked       },
+    { "packed + offset", casePackedOffset }
+};
+
+// Functions ------------------------------------------------------------------------------------------------------------------
+
+double timeSeconds()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+// Run Case
+// - Times the specified case, reports the cost per point in nanoseconds and cycles.
+void runCase(struct benchmarkCase* benchmark, uint32_t pointCount)
+{
+    double   start       = timeSeconds();
+    uint64_t startCycles = CYCLES();
+
+    for(uint32_t index = 0; index < ITERATIONS; ++index) benchmark->method();
+
+    uint64_t cycles  = CYCLES() - startCycles;
+    double   elapsed = timeSeconds() - start;
+    double   points  = (double)pointCount * ITERATIONS;
+
+    printf("%-20s %12.2f %12.2f\n", benchmark->name, elapsed * 1e9 / points, cycles / points);
+}
+
+// Verify
+// - Decodes every frame and compares it against its source. Returns false on any mismatch.
+bool verify()
+{
+    if(xyPackedFrameCount(animation) != FRAME_COUNT) return false;
+
+    for(uint16_t frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        const uint8_t* packed = xyPackedFrame(animation, frame);
+        if(xyPackedCount(packed) != frameSizes[frame]) return false;
+
+        xyPackedReader_t reader;
+        xyPackedBegin(&reader, packed);
+
+        for(uint16_t index = 0; index < frameSizes[frame]; ++index)
+        {
+            xyPoint_t point;
+            if(xyPackedRead(&reader, &point, 1) != 1) return false;
+            if(point.x != frames[frame][index].x || point.y != frames[frame][index].y) return false;
+        }
+
+        // Frame must end exactly where the next begins
+        if(reader.data != xyPackedFrame(animation, frame + 1)) return false;
+    }
+
+    return true;
+}
+
+// Entrypoint -----------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    uint32_t size = xyPackedAnimationSize(frames, frameSizes, FRAME_COUNT);
+    animation = malloc(size);
+    xyPackedEncodeAnimation(frames, frameSizes, FRAME_COUNT, animation);
+
+    if(!verify())
+    {
+        printf("Packed animation does not match its source\n");
+        return 1;
+    }
+
+    // Share of the deltas fitting in a single byte, offsets of [-8, 7] except (-8, -8)
+    uint32_t pointCount = 0;
+    uint32_t deltaCount = 0;
+    uint32_t shortCount = 0;
+    for(uint16_t frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        pointCount += frameSizes[frame];
+
+        for(uint16_t index = 1; index < frameSizes[frame]; ++index)
+        {
+            int32_t deltaX = frames[frame][index].x - frames[frame][index - 1].x;
+            int32_t deltaY = frames[frame][index].y - frames[frame][index - 1].y;
+
+            ++deltaCount;
+            if(deltaX >= -8 && deltaX <= 7 && deltaY >= -8 && deltaY <= 7 && (deltaX != -8 || deltaY != -8)) ++shortCount;
+        }
+    }
+
+    // Point arrays, plus the frame and size tables, as laid out on the RP2040 (32-bit pointers)
+    uint32_t unpackedSize = pointCount * sizeof(xyPoint_t) + FRAME_COUNT * (4 + sizeof(uint16_t));
+
+    printf("# Packed animation benchmark, %i frames, %u points\n", FRAME_COUNT, pointCount);
+    printf("%-20s %12s %12s\n", "format", "bytes", "bits_point");
+    printf("%-20s %12u %12.2f\n", "unpacked", unpackedSize, 8.0 * unpackedSize / pointCount);
+    printf("%-20s %12u %12.2f\n", "packed", size, 8.0 * size / pointCount);
+    printf("compression ratio %.2f:1\n", (double)unpackedSize / size);
+
+    printf("single byte deltas %.1f%%\n", 100.0 * shortCount / deltaCount);
+
+    printf("\n# Decode cost, %i iterations, chunks of %i points\n", ITERATIONS, CHUNK_SIZE);
+    printf("%-20s %12s %12s\n", "method", "ns_point", "cycles_point");
+
+    for(uint16_t index = 0; index < sizeof(cases) / sizeof(cases[0]); ++index) runCase(&cases[index], pointCount);
+
+    // Keep the decoded values live
+    if(checksum == 0) printf("\n");
+
+    free(animation);
+    return 0;
+}
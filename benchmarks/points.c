@@ -0,0 +1,157 @@
+// Point Kernel Check ---------------------------------------------------------------------------------------------------------
+//
+// Author: Cole Barach
+//
+// Description: Checks the portable point kernels (see 'xy_points.h') against a model of the RP2040 interpolator lanes,
+//   configured the same way as the interpolator implementation. The model follows the lane datapath of the RP2040
+//   datasheet: the accumulator is logically shifted right, masked, optionally sign-extended from the top bit of the mask,
+//   then added to the lane's base. Results are read back truncated to the coordinate width, same as the kernels.
+//
+//   Every edge value and a large number of random points and offsets are run through both, in place and out of place. Any
+//   mismatch is printed and the check fails.
+
+// Libraries ------------------------------------------------------------------------------------------------------------------
+
+// X-Y Library
+#include <xy_points.h>
+
+// C Standard Libraries
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Parameters -----------------------------------------------------------------------------------------------------------------
+
+#define RANDOM_COUNT 2000000             // Number of random points to check
+#define BATCH_SIZE   256                 // Points per kernel call
+#define SEED         0x5EED              // Random seed, for reproducible results
+
+// Interpolator Model ---------------------------------------------------------------------------------------------------------
+
+// Lane Configuration
+// - Subset of the interpolator's CTRL_LANE fields used by the kernels.
+struct laneConfig
+{
+    uint8_t shift;                       // Right shift applied to the accumulator.
+    uint8_t maskLsb;                     // Lowest bit of the mask (inclusive).
+    uint8_t maskMsb;                     // Highest bit of the mask (inclusive).
+    bool    signedResult;                // Sign-extends the masked value from the highest bit of the mask.
+};
+
+// Default Configuration
+// - Same as 'interp_default_config()', no shift, full mask, unsigned.
+static const struct laneConfig configDefault = { .shift = 0, .maskLsb = 0, .maskMsb = 31, .signedResult = false };
+
+// Lane Result
+// - Value read from the lane's PEEK register, given its configuration, accumulator and base.
+uint32_t laneResult(const struct laneConfig* config, uint32_t accum, uint32_t base)
+{
+    uint32_t mask  = (0xFFFFFFFFu >> (31 - config->maskMsb)) & (0xFFFFFFFFu << config->maskLsb);
+    uint32_t value = (accum >> config->shift) & mask;
+
+    if(config->signedResult && config->maskMsb < 31 && (value & (1u << config->maskMsb)))
+        value |= 0xFFFFFFFFu << (config->maskMsb + 1);
+
+    return base + value;
+}
+
+// Model Offset
+// - Interpolator implementation of 'xyPointsOffset', with interp0 replaced by the lane model. Register writes of signed
+//   values sign-extend to 32 bits, same as the hardware's.
+void modelOffset(const xyPoint_t* source, xyPoint_t* destination, uint16_t count, xyCoord_t offsetX, xyCoord_t offsetY)
+{
+    for(uint16_t index = 0; index < count; ++index)
+    {
+        destination[index].x = (xyCoord_t)laneResult(&configDefault, (uint32_t)(int32_t)source[index].x, (uint32_t)(int32_t)offsetX);
+        destination[index].y = (xyCoord_t)laneResult(&configDefault, (uint32_t)(int32_t)source[index].y, (uint32_t)(int32_t)offsetY);
+    }
+}
+
+// Global Memory --------------------------------------------------------------------------------------------------------------
+
+xyPoint_t source[BATCH_SIZE];
+xyPoint_t expected[BATCH_SIZE];
+xyPoint_t actual[BATCH_SIZE];
+xyPoint_t inPlace[BATCH_SIZE];
+
+uint32_t pointCount    = 0;
+uint32_t mismatchCount = 0;
+
+// Functions ------------------------------------------------------------------------------------------------------------------
+
+// Random Coordinate
+// - Returns a random coordinate spanning the full range of the type.
+xyCoord_t randomCoord()
+{
+    return (xyCoord_t)(rand() & 0xFFFF);
+}
+
+// Check Batch
+// - Runs the first 'count' points of the source through the model and the portable kernel, counting any mismatches.
+void checkBatch(uint16_t count, xyCoord_t offsetX, xyCoord_t offsetY)
+{
+    modelOffset(source, expected, count, offsetX, offsetY);
+    xyPointsOffset(source, actual, count, offsetX, offsetY);
+
+    for(uint16_t index = 0; index < count; ++index)
+        inPlace[index] = source[index];
+    xyPointsOffset(inPlace, inPlace, count, offsetX, offsetY);
+
+    for(uint16_t index = 0; index < count; ++index)
+    {
+        bool match = actual[index].x == expected[index].x && actual[index].y == expected[index].y
+            && inPlace[index].x == expected[index].x && inPlace[index].y == expected[index].y;
+
+        if(!match)
+        {
+            // Only the first few are worth printing
+            if(mismatchCount < 8)
+            {
+                printf("Mismatch: (%i, %i) + (%i, %i): model (%i, %i), kernel (%i, %i), in place (%i, %i)\n",
+                    source[index].x, source[index].y, offsetX, offsetY, expected[index].x, expected[index].y,
+                    actual[index].x, actual[index].y, inPlace[index].x, inPlace[index].y);
+            }
+
+            ++mismatchCount;
+        }
+    }
+
+    pointCount += count;
+}
+
+// Entrypoint -----------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    srand(SEED);
+
+    // Edge values, every combination of point and offset
+    static const xyCoord_t edges[] = { INT16_MIN, INT16_MIN + 1, -256, -1, 0, 1, 255, 256, 4095, 4096, INT16_MAX - 1, INT16_MAX };
+    const uint16_t edgeCount = sizeof(edges) / sizeof(edges[0]);
+
+    for(uint16_t pointIndex = 0; pointIndex < edgeCount * edgeCount; ++pointIndex)
+    {
+        source[pointIndex].x = edges[pointIndex % edgeCount];
+        source[pointIndex].y = edges[pointIndex / edgeCount];
+    }
+
+    for(uint16_t offsetIndex = 0; offsetIndex < edgeCount * edgeCount; ++offsetIndex)
+        checkBatch(edgeCount * edgeCount, edges[offsetIndex % edgeCount], edges[offsetIndex / edgeCount]);
+
+    // Random points and offsets
+    for(uint32_t batch = 0; batch < RANDOM_COUNT / BATCH_SIZE; ++batch)
+    {
+        for(uint16_t index = 0; index < BATCH_SIZE; ++index)
+        {
+            source[index].x = randomCoord();
+            source[index].y = randomCoord();
+        }
+
+        checkBatch(BATCH_SIZE, randomCoord(), randomCoord());
+    }
+
+    printf("Kernel           points mismatches\n");
+    printf("xyPointsOffset %8u %10u\n", pointCount, mismatchCount);
+
+    return mismatchCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
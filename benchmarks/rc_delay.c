@@ -0,0 +1,138 @@
+// RC Delay Benchmark ---------------------------------------------------------------------------------------------------------
+//
+// Author: Cole Barach
+//
+// Description: Compares the throughput of the two methods of calculating the move delay, the per-point logarithm used by
+//   previous versions of the library and the lookup table generated by xyRcSettlingTable. Each method is run over every step
+//   size in the table, results are grouped into bands of step size and reported in points per second.
+//
+//   Note: The host has an FPU, the gap on the RP2040 (soft-float) is considerably larger than what is measured here.
+
+// Libraries ------------------------------------------------------------------------------------------------------------------
+
+// X-Y Library
+#include <xy_hardware.h>
+#include <xy_math.h>
+
+// C Standard Libraries
+#include <stdio.h>
+#include <time.h>
+
+// Parameters -----------------------------------------------------------------------------------------------------------------
+
+#define RC_CONSTANT_US   4               // RC constant of the output filter (same as the examples)
+#define RC_PIXEL_THRES   1               // Threshold of the cursor's accuracy (same as the examples)
+
+#define TABLE_SIZE       1024            // Number of step sizes to tabulate (same as 'xy_hardware.c')
+#define ITERATIONS       20000           // Number of moves to time per step size
+
+#define BAND_COUNT       6
+uint16_t bandBounds[BAND_COUNT + 1] = { 0, 2, 8, 32, 128, 256, TABLE_SIZE };
+
+// Global Memory --------------------------------------------------------------------------------------------------------------
+
+uint16_t delayTable[TABLE_SIZE];
+
+volatile uint32_t delaySink = 0;         // Prevents the compiler from discarding results
+
+// Delay Methods --------------------------------------------------------------------------------------------------------------
+
+// Legacy Delay
+// - Per-point evaluation, as performed by xyGetMoveDelayUs prior to the lookup table.
+uint16_t delayLegacy(xyCoord_t x1, xyCoord_t y1, xyCoord_t x2, xyCoord_t y2)
+{
+    xyCoordLong_t deltaX = (xyCoordLong_t)x2 - x1;
+    xyCoordLong_t deltaY = (xyCoordLong_t)y2 - y1;
+
+    if(deltaX < 0) deltaX = -deltaX;
+    if(deltaY < 0) deltaY = -deltaY;
+    xyCoordLong_t deltaMax = deltaX > deltaY ? deltaX : deltaY;
+
+    return xyRcSettlingUs(deltaMax, RC_CONSTANT_US, RC_PIXEL_THRES);
+}
+
+// Lookup Delay
+// - Lookup, as performed by xyGetMoveDelayUs.
+uint16_t delayLookup(xyCoord_t x1, xyCoord_t y1, xyCoord_t x2, xyCoord_t y2)
+{
+    xyCoordLong_t deltaX = (xyCoordLong_t)x2 - x1;
+    xyCoordLong_t deltaY = (xyCoordLong_t)y2 - y1;
+
+    if(deltaX < 0) deltaX = -deltaX;
+    if(deltaY < 0) deltaY = -deltaY;
+    xyCoordLong_t deltaMax = deltaX > deltaY ? deltaX : deltaY;
+
+    if(deltaMax >= TABLE_SIZE) return xyRcSettlingUs(deltaMax, RC_CONSTANT_US, RC_PIXEL_THRES);
+    return delayTable[deltaMax];
+}
+
+// Functions ------------------------------------------------------------------------------------------------------------------
+
+double timeSeconds()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+// Run Band
+// - Times the specified method over every step size in the band, returns the throughput in points per second.
+double runBand(uint16_t (*method)(xyCoord_t, xyCoord_t, xyCoord_t, xyCoord_t), uint16_t lowerBound, uint16_t upperBound)
+{
+    uint32_t sum = 0;
+    double start = timeSeconds();
+
+    for(uint16_t delta = lowerBound; delta < upperBound; ++delta)
+    {
+        for(uint32_t index = 0; index < ITERATIONS; ++index)
+        {
+            // Alternate direction and axis so both branches of the delta calculation are exercised
+            xyCoord_t offset = index & 1 ? delta : -delta;
+            sum += method(0, 0, offset, (xyCoord_t)(offset / 2));
+        }
+    }
+
+    double elapsed = timeSeconds() - start;
+    delaySink += sum;
+
+    return (double)(upperBound - lowerBound) * ITERATIONS / elapsed;
+}
+
+// Entrypoint -----------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    xyRcSettlingTable(delayTable, TABLE_SIZE, RC_CONSTANT_US, RC_PIXEL_THRES);
+
+    // Verify the methods agree
+    uint32_t mismatches = 0;
+    for(uint16_t delta = 0; delta < TABLE_SIZE; ++delta)
+    {
+        if(delayLegacy(0, 0, delta, 0) != delayLookup(0, 0, delta, 0)) ++mismatches;
+    }
+
+    printf("# RC delay benchmark, RC = %ius, threshold = %ipx, %i iterations per step size\n", RC_CONSTANT_US, RC_PIXEL_THRES, ITERATIONS);
+    printf("# Mismatches: %u\n", mismatches);
+    printf("%-12s %16s %16s %8s\n", "steps", "legacy_pts_s", "table_pts_s", "speedup");
+
+    double legacyTotal = 0;
+    double tableTotal  = 0;
+
+    for(uint16_t band = 0; band < BAND_COUNT; ++band)
+    {
+        double legacy = runBand(delayLegacy, bandBounds[band], bandBounds[band + 1]);
+        double table  = runBand(delayLookup, bandBounds[band], bandBounds[band + 1]);
+
+        // Accumulate time per point, weighted by the number of step sizes in the band
+        legacyTotal += (bandBounds[band + 1] - bandBounds[band]) / legacy;
+        tableTotal  += (bandBounds[band + 1] - bandBounds[band]) / table;
+
+        char label[16];
+        snprintf(label, sizeof(label), "[%i, %i)", bandBounds[band], bandBounds[band + 1]);
+        printf("%-12s %16.0f %16.0f %7.2fx\n", label, legacy, table, table / legacy);
+    }
+
+    printf("%-12s %16.0f %16.0f %7.2fx\n", "all", TABLE_SIZE / legacyTotal, TABLE_SIZE / tableTotal, legacyTotal / tableTotal);
+
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,546 @@
+// Renderer Benchmark ---------------------------------------------------------------------------------------------------------
+//
+// Author: Cole Barach
+//
+// Description: Runs the scenes of the example programs through the renderer, against the virtual clock of the host
+//   simulation (see 'xy_host.h'). The renderer itself is unmodified, core 1 runs as a thread and the output engine plays
+//   the streams it submits with the timing of the RP2040.
+//
+//   Static scenes are committed once, animated scenes are committed once per step of their animation. After each commit the
+//   resulting stream is played for a single frame and its metrics are recorded. One row is output per scene, averaged over
+//   its commits (except the maximum period).
+//
+//   All results are in virtual time, so they are exactly reproducible. Compare against 'renderer_baseline.txt' to spot
+//   regressions (see 'make renderer_check').
+//
+// Columns:
+//   scene     - Name of the example program the scene is taken from.
+//   commits   - Number of commits (frames of the animation) measured.
+//   points    - Samples output per frame (shape points, blanked moves and color holds).
+//   period_us - Mean frame period.
+//   max_us    - Longest frame period.
+//   lit_us    - Mean time spent with the beam on, per frame.
+//   travel_us - Mean time spent on blanked moves, per frame.
+//   color_us  - Mean time spent waiting for color changes, per frame.
+//   colors    - Mean number of color changes per frame.
+//   bright_cv - Mean coefficient of variation of the stroke brightness (energy per pixel of lit travel), lower is more
+//               uniform.
+//   fps       - Frame rate of the mean period.
+//   points_s  - Points output per second.
+
+// Libraries ------------------------------------------------------------------------------------------------------------------
+
+// X-Y Library
+#include <xy_renderer.h>
+#include <xy_shapes.h>
+#include <xy_host.h>
+#include <xy_packed.h>
+
+// C Standard Libraries
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// POSIX Libraries
+#include <sched.h>
+
+// Example Models
+#include "../examples/pico/animation/models.h"
+#include "../examples/pico/crt_diagram/models.h"
+
+// Parameters -----------------------------------------------------------------------------------------------------------------
+
+// Same setup as every example
+#define X_PORT_OFFSET  0
+#define X_PORT_SIZE    8
+#define Y_PORT_OFFSET  8
+#define Y_PORT_SIZE    8
+#define RC_CONSTANT_US 4
+#define RC_PIXEL_THRES 1
+#define Z_DELAY_US     20
+#define SCREEN_WIDTH   0x100
+#define SCREEN_HEIGHT  0x100
+
+#define TRANSLATION_COMMITS 200          // Number of steps of the translation animation to measure (one full period).
+#define TRANSLATION_STEP    0.0314f      // Time step of the translation animation per commit.
+
+#define STEP_MAX            4            // Maximum step of the constant velocity scenes (see xyRendererSetInterpolation).
+#define STEP_DWELL_US       4            // Dwell of each step of the constant velocity scenes.
+
+#define HILBERT_SIZE        512          // Size of the Hilbert curve model (same as the example).
+
+#define SPRITE_COUNT        64           // Number of sprites alive at once.
+#define SPRITE_RESPAWNS     16           // Number of sprites replaced per commit.
+#define SPRITE_COMMITS      100          // Number of commits of the sprites scene to measure.
+
+#define GRID_CELLS          8            // Number of cells along each side of the grid scene.
+#define GRID_SPACING        0x1E         // Size of each cell of the grid scene.
+
+#define STRINGS_COMMITS     100          // Number of updates of the counter string to measure.
+#define STRING_POINT_COUNT  1024         // Size of the point buffer of each baked string.
+#define STRING_BREAK_COUNT  256          // Size of the break buffer of each baked string.
+
+// Datatypes ------------------------------------------------------------------------------------------------------------------
+
+// Scene
+// - Setup is called once to populate the back stack, update is called before each commit.
+struct scene
+{
+    const char* name;
+    void        (*setup)();
+    void        (*update)(uint16_t commit);
+    uint16_t    commits;
+};
+
+// Scene Results
+// - Sums of the frame metrics over each commit.
+struct sceneResults
+{
+    uint64_t periodTicks;
+    uint64_t periodTicksMax;
+    uint64_t litTicks;
+    uint64_t travelTicks;
+    uint64_t colorTicks;
+    uint64_t moveCount;
+    uint64_t colorCount;
+    double   brightnessCv;
+};
+
+// Scenes ---------------------------------------------------------------------------------------------------------------------
+// - Each replicates the scene of the example program of the same name. Suffixed scenes are variants of said scene, rendered
+//   through a different API. The remaining scenes exercise a specific API.
+
+void setupHelloWorld()
+{
+    xyRenderString("HELLO,WORLD!", xyScreenWidth() / 2 - 0x30, xyScreenHeight() / 2 - 0x14, xyScreenWidth() / 2 + 0x30, xyScreenHeight() / 2 + 0x14);
+}
+
+void setupStrings()
+{
+    xyRenderString(
+        "The X-Y library "
+        "can render stri-"
+        "ngs like this!\n"
+        "\"I'm in the top "
+        "paragraph\"\n"
+        "----------------", 0x00, 0x80, 0x100, 0x100);
+
+    xyRenderString(
+        "Here's  "
+        "the bot-"
+        "tom left"
+        "block!  ", 0x00, 0x00, 0x80, 0x80);
+
+    xyRenderString(
+        "And the"
+        "bottom "
+        "right  "
+        "block! ", 0x90, 0x00, 0x100, 0x80);
+
+    xyRendererOptimize();
+}
+
+// Same as the strings scene, each string baked into a single shape
+void setupStringsBaked()
+{
+    static xyPoint_t points[3][STRING_POINT_COUNT];
+    static uint16_t  breaks[3][STRING_BREAK_COUNT];
+
+    xyRenderStringBaked(
+        "The X-Y library "
+        "can render stri-"
+        "ngs like this!\n"
+        "\"I'm in the top "
+        "paragraph\"\n"
+        "----------------", 0x00, 0x80, 0x100, 0x100, points[0], STRING_POINT_COUNT, breaks[0], STRING_BREAK_COUNT);
+
+    xyRenderStringBaked(
+        "Here's  "
+        "the bot-"
+        "tom left"
+        "block!  ", 0x00, 0x00, 0x80, 0x80, points[1], STRING_POINT_COUNT, breaks[1], STRING_BREAK_COUNT);
+
+    xyRenderStringBaked(
+        "And the"
+        "bottom "
+        "right  "
+        "block! ", 0x90, 0x00, 0x100, 0x80, points[2], STRING_POINT_COUNT, breaks[2], STRING_BREAK_COUNT);
+
+    xyRendererOptimize();
+}
+
+// Same as the strings scene, plus a counter below the bottom-right block updated every commit
+xyString_t counterString;
+
+void setupStringsUpdate()
+{
+    setupStrings();
+
+    counterString = xyRenderString(
+        "Commit "
+        "      0", 0x90, 0x00, 0x100, 0x30);
+}
+
+void updateStringsUpdate(uint16_t commit)
+{
+    char text[16];
+    snprintf(text, sizeof(text), "Commit %7u", commit);
+    xyStringUpdate(&counterString, text);
+}
+
+void setupAsciiTable()
+{
+    for(uint16_t row = 0; row < 8; ++row)
+    {
+        if(row % 2 == 0)
+        {
+            for(int16_t column = 0; column < 16; ++column) xyRenderChar(row * 0x10 + column, column * 0x10, 0x8C - row * 0x14);
+        }
+        else
+        {
+            for(int16_t column = 15; column >= 0; --column) xyRenderChar(row * 0x10 + column, column * 0x10, 0x8C - row * 0x14);
+        }
+    }
+}
+
+#define SIZE_SQUARE_MODEL 9
+xyPoint_t squareModel[SIZE_SQUARE_MODEL] =
+{
+    {0, 0}, {16, 0}, {32, 0}, {32, 16}, {32, 32}, {16, 32}, {0, 32}, {0, 16}, {0, 0}
+};
+
+#define SIZE_DIAMOND_MODEL 9
+xyPoint_t diamondModel[SIZE_DIAMOND_MODEL] =
+{
+    {8, 0}, {12, 4}, {16, 8}, {12, 12}, {8, 16}, {4, 12}, {0, 8}, {4, 4}, {8, 0}
+};
+
+#define SIZE_CIRCLE_MODEL   17
+#define RADIUS_CIRCLE_MODEL 32.0f
+xyPoint_t circleModel[SIZE_CIRCLE_MODEL];
+
+volatile xyShape_t* translationShapes[5];
+
+void setupTranslation()
+{
+    for(uint16_t index = 0; index < SIZE_CIRCLE_MODEL - 1; ++index)
+    {
+        float theta = 2.0f * M_PI * index / (SIZE_CIRCLE_MODEL - 1);
+
+        circleModel[index].x = RADIUS_CIRCLE_MODEL * cosf(theta) + RADIUS_CIRCLE_MODEL;
+        circleModel[index].y = RADIUS_CIRCLE_MODEL * sinf(theta) + RADIUS_CIRCLE_MODEL;
+    }
+    circleModel[SIZE_CIRCLE_MODEL - 1] = circleModel[0];
+
+    translationShapes[0] = xyRenderShape(squareModel, SIZE_SQUARE_MODEL, 8, 8, true);
+    translationShapes[1] = xyRenderShape(squareModel, SIZE_SQUARE_MODEL, 200, 8, true);
+    translationShapes[2] = xyRenderShape(diamondModel, SIZE_DIAMOND_MODEL, 0, 0, true);
+    translationShapes[3] = xyRenderShape(circleModel, SIZE_CIRCLE_MODEL, 128 - RADIUS_CIRCLE_MODEL, 128 - RADIUS_CIRCLE_MODEL, true);
+    translationShapes[4] = xyRenderShape(xyShape16x16Ascii['$'], xyShapeSize16x16Ascii['$'], 128 - 9, 128 - 12, true);
+}
+
+void updateTranslation(uint16_t commit)
+{
+    float time = commit * TRANSLATION_STEP;
+
+    xyShapeTransform(translationShapes[0], 16, 16, 0, 0, XY_FIXED_ONE, XY_FIXED_ONE, XY_ANGLE(time));
+    xyShapeTransform(translationShapes[1], 16, 16, 0, 0, XY_FIXED_ONE, XY_FIXED_ONE, XY_ANGLE(-2.0f * time));
+
+    translationShapes[2]->positionX = roundf(cos(time) * 96.0f + 120.0f);
+    translationShapes[2]->positionY = roundf(sin(2.0 * time) * 12.0f + 200.0f);
+
+    xyShapeTransform(translationShapes[3], RADIUS_CIRCLE_MODEL, RADIUS_CIRCLE_MODEL, 0, 0, XY_FIXED(cosf(time)), XY_FIXED_ONE, 0);
+    xyShapeTransform(translationShapes[4], 9, 12, 3, 4, XY_FIXED(1.5f * cosf(time)), XY_FIXED(1.5f), 0);
+}
+
+void setupCrtDiagram()
+{
+    // Mirrored in place, only once
+    static bool mirrored = false;
+
+    for(int index = 0; index < MODEL_COUNT; ++index)
+    {
+        if(!mirrored)
+        {
+            for(int pointIndex = 0; pointIndex < modelSizes[index]; ++pointIndex)
+            {
+                models[index][pointIndex].y = 255 - models[index][pointIndex].y;
+            }
+        }
+
+        volatile xyShape_t* shape = xyRenderShape(models[index], modelSizes[index], 0, 0, true);
+        shape->colorRed   = modelColors[index * 3];
+        shape->colorGreen = modelColors[index * 3 + 1];
+        shape->colorBlue  = modelColors[index * 3 + 2];
+    }
+    mirrored = true;
+
+    xyRendererOptimize();
+}
+
+xyPoint_t hilbertModel[HILBERT_SIZE];
+
+void populateHilbertCurve(xyPoint_t* model, uint16_t pointCount, uint16_t* pointIndex, int depth, int scale, int rotation, int direction)
+{
+    // See the procedural_models example for the derivation
+    if(depth == 0) return;
+
+    populateHilbertCurve(model, pointCount, pointIndex, depth - 1, scale, (rotation + 2 - direction) % 4, -direction);
+
+    if(*pointIndex + 1 >= pointCount) return;
+    model[*pointIndex + 1].x = model[*pointIndex].x + scale * cosf(M_PI_2 * rotation);
+    model[*pointIndex + 1].y = model[*pointIndex].y + scale * sinf(M_PI_2 * rotation);
+    ++(*pointIndex);
+
+    populateHilbertCurve(model, pointCount, pointIndex, depth - 1, scale, rotation, direction);
+
+    if(*pointIndex + 1 >= pointCount) return;
+    model[*pointIndex + 1].x = model[*pointIndex].x - scale * sinf(M_PI_2 * rotation) * direction;
+    model[*pointIndex + 1].y = model[*pointIndex].y + scale * cosf(M_PI_2 * rotation) * direction;
+    ++(*pointIndex);
+
+    populateHilbertCurve(model, pointCount, pointIndex, depth - 1, scale, rotation, direction);
+
+    if(*pointIndex + 1 >= pointCount) return;
+    model[*pointIndex + 1].x = model[*pointIndex].x - scale * cosf(M_PI_2 * rotation);
+    model[*pointIndex + 1].y = model[*pointIndex].y - scale * sinf(M_PI_2 * rotation);
+    ++(*pointIndex);
+
+    populateHilbertCurve(model, pointCount, pointIndex, depth - 1, scale, (rotation + 2 + direction) % 4, -direction);
+}
+
+void setupProceduralModels()
+{
+    hilbertModel[0].x = 0;
+    hilbertModel[0].y = 0;
+
+    uint16_t pointIndex = 0;
+    populateHilbertCurve(hilbertModel, HILBERT_SIZE, &pointIndex, 4, 16, 0, 1);
+
+    xyRenderShape(hilbertModel, pointIndex + 1, 0, 0, true);
+}
+
+volatile xyShape_t* animationFrame;
+
+void setupAnimation()
+{
+    animationFrame = xyRenderShape(frames[0], frameSizes[0], 0, 0, true);
+}
+
+void updateAnimation(uint16_t commit)
+{
+    animationFrame->points     = frames[commit];
+    animationFrame->pointCount = frameSizes[commit];
+}
+
+// Same as the animation scene, traced at a constant velocity
+void setupAnimationSteps()
+{
+    setupAnimation();
+    xyRendererSetInterpolation(STEP_MAX, STEP_DWELL_US);
+}
+
+// Packed animation, encoded from the same frames (see 'xy_packed.h'). Results should match the unpacked animation exactly.
+uint8_t* packedAnimation = NULL;
+
+void setupAnimationPacked()
+{
+    if(packedAnimation == NULL)
+    {
+        packedAnimation = malloc(xyPackedAnimationSize(frames, frameSizes, FRAME_COUNT));
+        xyPackedEncodeAnimation(frames, frameSizes, FRAME_COUNT, packedAnimation);
+    }
+
+    animationFrame = xyRenderPacked(xyPackedFrame(packedAnimation, 0), 0, 0, true);
+}
+
+void updateAnimationPacked(uint16_t commit)
+{
+    animationFrame->packed     = xyPackedFrame(packedAnimation, commit);
+    animationFrame->pointCount = xyPackedCount(animationFrame->packed);
+}
+
+// Sprites spawned and removed every commit, the oldest being replaced (see xyRendererRemove)
+volatile xyShape_t* sprites[SPRITE_COUNT];
+uint32_t            spriteSeed;
+
+volatile xyShape_t* spawnSprite()
+{
+    // Linear congruential generator, same sequence every run
+    spriteSeed = spriteSeed * 1664525 + 1013904223;
+    return xyRenderChar('*', (spriteSeed >> 8) % 0xF0, (spriteSeed >> 16) % 0xF0);
+}
+
+void setupSprites()
+{
+    spriteSeed = 1;
+    for(uint16_t index = 0; index < SPRITE_COUNT; ++index) sprites[index] = spawnSprite();
+}
+
+void updateSprites(uint16_t commit)
+{
+    for(uint16_t index = 0; index < SPRITE_RESPAWNS; ++index)
+    {
+        uint16_t sprite = (commit * SPRITE_RESPAWNS + index) % SPRITE_COUNT;
+        xyRendererRemove(sprites[sprite]);
+        sprites[sprite] = spawnSprite();
+    }
+}
+
+// Grid of individual edges, horizontal and vertical edges differing in color, added in a scrambled order
+xyPoint_t gridEdges[2 * GRID_CELLS * (GRID_CELLS + 1)][2];
+
+void setupGrid()
+{
+    uint16_t edgeCount = sizeof(gridEdges) / sizeof(gridEdges[0]);
+    uint16_t edge      = 0;
+
+    for(uint16_t line = 0; line <= GRID_CELLS; ++line)
+    {
+        for(uint16_t cell = 0; cell < GRID_CELLS; ++cell)
+        {
+            // Horizontal
+            gridEdges[edge][0].x = cell * GRID_SPACING;
+            gridEdges[edge][0].y = line * GRID_SPACING;
+            gridEdges[edge][1].x = (cell + 1) * GRID_SPACING;
+            gridEdges[edge][1].y = line * GRID_SPACING;
+            ++edge;
+
+            // Vertical
+            gridEdges[edge][0].x = line * GRID_SPACING;
+            gridEdges[edge][0].y = cell * GRID_SPACING;
+            gridEdges[edge][1].x = line * GRID_SPACING;
+            gridEdges[edge][1].y = (cell + 1) * GRID_SPACING;
+            ++edge;
+        }
+    }
+
+    // Shuffle with a linear congruential generator, same order every run
+    uint32_t seed = 1;
+    for(uint16_t index = edgeCount - 1; index > 0; --index)
+    {
+        seed = seed * 1664525 + 1013904223;
+        uint16_t other = (seed >> 8) % (index + 1);
+
+        for(uint16_t point = 0; point < 2; ++point)
+        {
+            xyPoint_t swap          = gridEdges[index][point];
+            gridEdges[index][point] = gridEdges[other][point];
+            gridEdges[other][point] = swap;
+        }
+    }
+
+    for(uint16_t index = 0; index < edgeCount; ++index)
+    {
+        volatile xyShape_t* shape = xyRenderShape(gridEdges[index], 2, 0, 0, true);
+
+        bool vertical = gridEdges[index][0].x == gridEdges[index][1].x;
+        shape->colorRed   = vertical ? 255 : 0;
+        shape->colorGreen = 255;
+        shape->colorBlue  = vertical ? 0 : 255;
+    }
+
+    xyRendererOptimize();
+}
+
+struct scene scenes[] =
+{
+    { "hello_world",       setupHelloWorld,       NULL,              1                   },
+    { "strings",           setupStrings,          NULL,              1                   },
+    { "strings_baked",     setupStringsBaked,     NULL,              1                   },
+    { "strings_update",    setupStringsUpdate,    updateStringsUpdate, STRINGS_COMMITS   },
+    { "ascii_table",       setupAsciiTable,       NULL,              1                   },
+    { "translation",       setupTranslation,      updateTranslation, TRANSLATION_COMMITS },
+    { "crt_diagram",       setupCrtDiagram,       NULL,              1                   },
+    { "procedural_models", setupProceduralModels, NULL,              1                   },
+    { "animation",         setupAnimation,        updateAnimation,   FRAME_COUNT         },
+    { "animation_packed",  setupAnimationPacked,  updateAnimationPacked, FRAME_COUNT     },
+    { "animation_steps",   setupAnimationSteps,   updateAnimation,   FRAME_COUNT         },
+    { "sprites",           setupSprites,          updateSprites,     SPRITE_COMMITS      },
+    { "grid",              setupGrid,             NULL,              1                   }
+};
+
+// Functions ------------------------------------------------------------------------------------------------------------------
+
+// Play Commit
+// - Commits the back stack and plays the resulting stream for a single frame, adding its metrics to the results.
+void playCommit(struct sceneResults* results)
+{
+    xyHostFrameStats_t stats;
+    xyHostGetFrameStats(&stats);
+    uint32_t previous = stats.stream;
+
+    xyRendererCommit();
+
+    // Wait for the renderer to submit the stream, then play until a whole frame of it has been measured. The engine picks it
+    // up as the DMA finishes feeding a frame, which may be a frame ahead of the one playing.
+    while(!xyStreamPending()) sched_yield();
+
+    do
+    {
+        xyHostRunFrames(1);
+        xyHostGetFrameStats(&stats);
+    }
+    while(stats.stream == previous);
+
+    results->periodTicks += stats.periodTicks;
+    results->litTicks    += stats.litTicks;
+    results->travelTicks += stats.travelTicks;
+    results->colorTicks  += stats.colorTicks;
+    results->moveCount   += stats.moveCount;
+    results->colorCount  += stats.colorCount;
+    if(stats.strokeBrightnessMean > 0) results->brightnessCv += sqrt(stats.strokeBrightnessVariance) / stats.strokeBrightnessMean;
+    if(stats.periodTicks > results->periodTicksMax) results->periodTicksMax = stats.periodTicks;
+}
+
+// Run Scene
+// - Measures the specified scene and outputs its row of the table.
+void runScene(struct scene* scene)
+{
+    struct sceneResults results = {0};
+
+    // Interpolation is a setting of the back stack, not cleared with it
+    xyRendererClear();
+    xyRendererSetInterpolation(0, 0);
+    scene->setup();
+
+    for(uint16_t commit = 0; commit < scene->commits; ++commit)
+    {
+        if(scene->update != NULL) scene->update(commit);
+        playCommit(&results);
+    }
+
+    double commits = scene->commits;
+    double ticksUs = XY_STREAM_TICKS_PER_US;
+    double periodUs = results.periodTicks / commits / ticksUs;
+
+    printf("%-18s %7i %8.1f %10.1f %9.1f %9.1f %10.1f %9.1f %7.2f %9.3f %8.1f %10.0f\n",
+        scene->name, scene->commits, results.moveCount / commits, periodUs, results.periodTicksMax / ticksUs,
+        results.litTicks / commits / ticksUs, results.travelTicks / commits / ticksUs, results.colorTicks / commits / ticksUs,
+        results.colorCount / commits, results.brightnessCv / commits, 1e6 / periodUs, results.moveCount / commits * 1e6 / periodUs);
+}
+
+// Entrypoint -----------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    xySetupXy(X_PORT_OFFSET, X_PORT_SIZE, Y_PORT_OFFSET, Y_PORT_SIZE);
+    xySetupRcTiming(RC_CONSTANT_US, RC_PIXEL_THRES);
+    xySetupRgbzDelay(Z_DELAY_US);
+    xySetupScreen(SCREEN_WIDTH, SCREEN_HEIGHT, false);
+
+    xyRendererStart();
+
+    // Wait for the renderer's first (empty) stream to start playing
+    while(xyHostRunFrames(1) == 0) sched_yield();
+
+    printf("# Renderer benchmark, virtual time, RC constant %ius, color delay %ius\n", RC_CONSTANT_US, Z_DELAY_US);
+    printf("%-18s %7s %8s %10s %9s %9s %10s %9s %7s %9s %8s %10s\n",
+        "scene", "commits", "points", "period_us", "max_us", "lit_us", "travel_us", "color_us", "colors", "bright_cv", "fps",
+        "points_s");
+
+    for(uint16_t index = 0; index < sizeof(scenes) / sizeof(scenes[0]); ++index) runScene(&scenes[index]);
+
+    xyRendererStop();
+    return 0;
+}
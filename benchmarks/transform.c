@@ -0,0 +1,238 @@
+// Transform Benchmark --------------------------------------------------------------------------------------------------------
+//
+// Author: Cole Barach
+//
+// Description: Compares the shape transforms used by previous versions of the library (trig and rounding evaluated per point
+//   in floating-point) against the current ones (matrix evaluated once, points transformed in fixed-point). Reports the cost
+//   per point of each, and the accuracy of the fixed-point kernels against an exactly rounded double-precision reference.
+//
+//   Cycles are measured with the host's timestamp counter where available (x86), otherwise only nanoseconds are reported.
+//
+//   Note: The host has an FPU, the gap on the RP2040 (soft-float, no FPU) is considerably larger than what is measured here.
+
+// Libraries ------------------------------------------------------------------------------------------------------------------
+
+// X-Y Library
+#include <xy_renderer.h>
+#include <xy_math.h>
+
+// C Standard Libraries
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Cycle Counter
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLES() __rdtsc()
+#else
+#define CYCLES() 0
+#endif
+
+// Parameters -----------------------------------------------------------------------------------------------------------------
+
+#define POINT_COUNT      1024            // Number of points in the test shape
+#define ITERATIONS       2000            // Number of times to transform the shape per method
+
+#define ACCURACY_STEP    7               // Spacing of the accuracy test grid, in coordinates
+#define ANGLE_COUNT      64              // Number of angles in the accuracy test
+
+#define RANGE_COUNT      3
+xyCoord_t rangeBounds[RANGE_COUNT] = { 256, 1024, 4096 };
+
+// Global Memory --------------------------------------------------------------------------------------------------------------
+
+xyPoint_t source[POINT_COUNT];
+xyPoint_t destination[POINT_COUNT];
+
+// Legacy Transforms ----------------------------------------------------------------------------------------------------------
+
+// Legacy Translate
+// - Per-point evaluation, as performed by xyShapeTranslate prior to the fixed-point kernels.
+void legacyTranslate(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, xyCoord_t offsetX, xyCoord_t offsetY, float scalarX, float scalarY, float theta)
+{
+    for(uint16_t index = 0; index < sourceSize; ++index)
+    {
+        xyCoordLong_t x = (xyCoordLong_t)source[index].x + offsetX - originX;
+        xyCoordLong_t y = (xyCoordLong_t)source[index].y + offsetY - originY;
+
+        x *= scalarX;
+        y *= scalarY;
+
+        xyCoordLong_t xPrime = round(x * cosf(theta) - y * sinf(theta));
+        xyCoordLong_t yPrime = round(x * sinf(theta) + y * cosf(theta));
+
+        destination[index].x = (xyCoord_t)(xPrime + originX);
+        destination[index].y = (xyCoord_t)(yPrime + originY);
+    }
+}
+
+// Legacy Rotate
+// - Per-point evaluation, as performed by xyShapeRotate prior to the fixed-point kernels.
+void legacyRotate(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, float theta)
+{
+    for(uint16_t index = 0; index < sourceSize; ++index)
+    {
+        xyCoordLong_t x = (xyCoordLong_t)source[index].x - originX;
+        xyCoordLong_t y = (xyCoordLong_t)source[index].y - originY;
+
+        xyCoordLong_t xPrime = round(x * cosf(theta) - y * sinf(theta));
+        xyCoordLong_t yPrime = round(x * sinf(theta) + y * cosf(theta));
+
+        destination[index].x = (xyCoord_t)(xPrime + originX);
+        destination[index].y = (xyCoord_t)(yPrime + originY);
+    }
+}
+
+// Legacy Scale
+// - Per-point evaluation, as performed by xyShapeScale prior to the fixed-point kernels.
+void legacyScale(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, float scalarX, float scalarY)
+{
+    for(uint16_t index = 0; index < sourceSize; ++index)
+    {
+        xyCoordLong_t x = (xyCoordLong_t)source[index].x - originX;
+        xyCoordLong_t y = (xyCoordLong_t)source[index].y - originY;
+
+        destination[index].x = round((xyCoord_t)(x * scalarX + originX));
+        destination[index].y = round((xyCoord_t)(y * scalarY + originY));
+    }
+}
+
+// Benchmark Cases ------------------------------------------------------------------------------------------------------------
+
+// The angle and scalars are varied per iteration so no method can cache its result.
+
+void caseLegacyTranslate(uint32_t i) { legacyTranslate(source, destination, POINT_COUNT, 128, 128, 3, -2, 0.75f, 1.25f, i * 0.001f); }
+void caseTranslate(uint32_t i)       { xyShapeTranslate(source, destination, POINT_COUNT, 128, 128, 3, -2, 0.75f, 1.25f, i * 0.001f); }
+void caseTranslateFixed(uint32_t i)  { xyShapeTranslateFixed(source, destination, POINT_COUNT, 128, 128, 3, -2, XY_FIXED(0.75), XY_FIXED(1.25), i * 10); }
+void caseLegacyRotate(uint32_t i)    { legacyRotate(source, destination, POINT_COUNT, 128, 128, i * 0.001f); }
+void caseRotate(uint32_t i)          { xyShapeRotate(source, destination, POINT_COUNT, 128, 128, i * 0.001f); }
+void caseRotateFixed(uint32_t i)     { xyShapeRotateFixed(source, destination, POINT_COUNT, 128, 128, i * 10); }
+void caseRotateInt(uint32_t i)       { xyShapeRotateInt(source, destination, POINT_COUNT, 128, 128, i); }
+void caseLegacyScale(uint32_t i)     { legacyScale(source, destination, POINT_COUNT, 128, 128, 0.5f + i * 0.0001f, 1.5f); }
+void caseScale(uint32_t i)           { xyShapeScale(source, destination, POINT_COUNT, 128, 128, 0.5f + i * 0.0001f, 1.5f); }
+void caseScaleFixed(uint32_t i)      { xyShapeScaleFixed(source, destination, POINT_COUNT, 128, 128, XY_FIXED(0.5) + i * 7, XY_FIXED(1.5)); }
+
+struct benchmarkCase
+{
+    const char* name;
+    void (*method)(uint32_t);
+};
+
+struct benchmarkCase cases[] =
+{
+    { "legacy translate",  caseLegacyTranslate },
+    { "xyShapeTranslate",  caseTranslate       },
+    { "...TranslateFixed", caseTranslateFixed  },
+    { "legacy rotate",     caseLegacyRotate    },
+    { "xyShapeRotate",     caseRotate          },
+    { "...RotateFixed",    caseRotateFixed     },
+    { "...RotateInt",      caseRotateInt       },
+    { "legacy scale",      caseLegacyScale     },
+    { "xyShapeScale",      caseScale           },
+    { "...ScaleFixed",     caseScaleFixed      }
+};
+
+// Functions ------------------------------------------------------------------------------------------------------------------
+
+double timeSeconds()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+// Run Case
+// - Times the specified case, reports the cost per point in nanoseconds and cycles.
+void runCase(struct benchmarkCase* benchmark)
+{
+    double   start       = timeSeconds();
+    uint64_t startCycles = CYCLES();
+
+    for(uint32_t index = 0; index < ITERATIONS; ++index) benchmark->method(index);
+
+    uint64_t cycles  = CYCLES() - startCycles;
+    double   elapsed = timeSeconds() - start;
+    double   points  = (double)POINT_COUNT * ITERATIONS;
+
+    printf("%-20s %12.2f %12.2f\n", benchmark->name, elapsed * 1e9 / points, cycles / points);
+}
+
+// Measure Accuracy
+// - Compares xyShapeTranslateFixed against a double-precision reference, rounded to the nearest coordinate, for points
+//   within the specified distance of the origin. Reports the maximum error and the fraction of exact coordinates.
+void measureAccuracy(xyCoord_t range, xyFixed_t scalar)
+{
+    uint32_t coordinates = 0;
+    uint32_t exact       = 0;
+    int32_t  errorMax    = 0;
+
+    double scalarFloat = (double)scalar / XY_FIXED_ONE;
+
+    for(uint16_t angle = 0; angle < ANGLE_COUNT; ++angle)
+    {
+        // Odd multiple so the angles cover every octant and interpolation phase
+        xyAngle_t theta      = angle * 1031;
+        double    thetaFloat = theta * (6.283185307179586 / 65536);
+
+        for(xyCoordLong_t y = -range; y <= range; y += ACCURACY_STEP * (range / 256))
+        {
+            // Build a row of points (relative to the origin, before scaling)
+            uint16_t count = 0;
+            for(xyCoordLong_t x = -range; x <= range && count < POINT_COUNT; x += ACCURACY_STEP * (range / 256))
+            {
+                source[count].x = x / scalarFloat;
+                source[count].y = y / scalarFloat;
+                ++count;
+            }
+
+            xyShapeTranslateFixed(source, destination, count, 0, 0, 0, 0, scalar, scalar, theta);
+
+            for(uint16_t index = 0; index < count; ++index)
+            {
+                double x = source[index].x * scalarFloat;
+                double y = source[index].y * scalarFloat;
+
+                int32_t errorX = abs(destination[index].x - (int32_t)lround(x * cos(thetaFloat) - y * sin(thetaFloat)));
+                int32_t errorY = abs(destination[index].y - (int32_t)lround(x * sin(thetaFloat) + y * cos(thetaFloat)));
+
+                if(errorX > errorMax) errorMax = errorX;
+                if(errorY > errorMax) errorMax = errorY;
+                exact += (errorX == 0) + (errorY == 0);
+                coordinates += 2;
+            }
+        }
+    }
+
+    printf("%-8i %10.3f %10i %11.3f%%\n", range, scalarFloat, errorMax, 100.0 * exact / coordinates);
+}
+
+// Entrypoint -----------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    // Test shape, a spiral around the origin within the screen
+    for(uint16_t index = 0; index < POINT_COUNT; ++index)
+    {
+        float radius = 120.0f * index / POINT_COUNT;
+        source[index].x = (xyCoord_t)(128 + radius * cosf(index * 0.1f));
+        source[index].y = (xyCoord_t)(128 + radius * sinf(index * 0.1f));
+    }
+
+    printf("# Transform benchmark, %i points, %i iterations per method\n", POINT_COUNT, ITERATIONS);
+    printf("%-20s %12s %12s\n", "method", "ns_point", "cycles_point");
+
+    for(uint16_t index = 0; index < sizeof(cases) / sizeof(cases[0]); ++index) runCase(&cases[index]);
+
+    printf("\n# Accuracy of xyShapeTranslateFixed vs. exactly rounded reference, %i angles\n", ANGLE_COUNT);
+    printf("%-8s %10s %10s %12s\n", "range", "scalar", "max_error", "exact");
+
+    for(uint16_t index = 0; index < RANGE_COUNT; ++index)
+    {
+        measureAccuracy(rangeBounds[index], XY_FIXED(1));
+        measureAccuracy(rangeBounds[index], XY_FIXED(2.5));
+    }
+
+    return 0;
+}
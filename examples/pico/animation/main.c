@@ -19,7 +19,14 @@
 
 // Includes -------------------------------------------------------------------------------------------------------------------
 
+// Define ANIMATION_PACKED to play the packed animation from flash (see 'render/makefile', target 'generate_packed').
+// Define ANIMATION_CONTOURS to blank the moves between the polylines of traced models (target 'generate_contours').
+#ifdef ANIMATION_PACKED
+#include <xy_packed.h>
+#include "models_packed.h"
+#else
 #include "models.h"
+#endif
 
 // I/O & Timing ---------------------------------------------------------------------------------------------------------------
 
@@ -51,7 +58,11 @@ int main()
     // Start rendering
     xyRendererStart();
 
+    #ifdef ANIMATION_PACKED
+    volatile xyShape_t* frame = xyRenderPacked(xyPackedFrame(animation, 0), 0, 0, true);
+    #else
     volatile xyShape_t* frame = xyRenderShape(frames[0], frameSizes[0], 0, 0, true);
+    #endif
 
     // Time parameter
     uint16_t frameIndex = 0;
@@ -59,8 +70,21 @@ int main()
     while(true)
     {
         // Update models
+        // - Both fields are picked up together by the commit, the renderer never sees one without the other.
+        #ifdef ANIMATION_PACKED
+        frame->packed = xyPackedFrame(animation, frameIndex);
+        frame->pointCount = xyPackedCount(frame->packed);
+        #else
         frame->points = frames[frameIndex];
         frame->pointCount = frameSizes[frameIndex];
+        #endif
+
+        #ifdef ANIMATION_CONTOURS
+        frame->breaks = frameBreaks[frameIndex];
+        frame->breakCount = frameBreakCounts[frameIndex];
+        #endif
+
+        xyRendererCommit();
 
         // 11 FPS
         sleep_ms(90);
@@ -1,8 +1,100 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
 
-#define POINT_CULL_MODULUS 12
+#include <xy_math.h>
+#include <xy_packed.h>
+
+#define GRID_CELL_POINTS 2               // Average number of points per cell of the spatial index.
+
+#define SIMPLIFY_TOLERANCE 1.0           // Default distance a dropped point may lie from the simplified path, in pixels.
+
+#define RC_CONSTANT_US 4                 // RC timing of the animation example, used as the cost of each move.
+#define RC_PIXEL_THRES 1
+#define Z_DELAY_US 20                    // Color delay of the animation example, the beam is turned on and off once per
+                                         // polyline.
+#define RC_TABLE_SIZE 1024               // Largest move looked up, larger moves are calculated.
+
+#define CONTOUR_LENGTH_MIN 3             // Shortest contour kept when tracing, in pixels. Shorter ones are mostly noise.
+
+#define REFINE_NEIGHBORS 8               // Number of nearest points considered as the new neighbors of a point.
+#define REFINE_SEGMENT_MAX 3             // Longest segment moved by Or-opt.
+#define REFINE_BUDGET_MS 100             // Default time budget of the refinement, per frame.
+
+// Usage: sort_and_format.out [-b] [-c] [-l] [-j threads] [-e pixels] [-f fps] [-r] [-t milliseconds] < edges > models.h
+//   -b  Emit the packed format (see 'xy_packed.h') rather than point arrays.
+//   -c  Trace the edges into polylines (see traceFrame) rather than visiting every point in a single tour. The index of the
+//       first point of each polyline is emitted with each frame (frameBreaks), the move to it is meant to be blanked.
+//   -l  Order points by linear scan rather than the spatial index. Both produce identical output, the scan is kept as a
+//       reference.
+//   -j  Number of frames to order in parallel, defaults to the number of processors.
+//   -e  Tolerance of the simplification (see simplifyFrame), defaults to SIMPLIFY_TOLERANCE.
+//   -f  Target refresh rate. Frames that would take longer to draw are simplified further, until they fit. Unlimited by
+//       default.
+//   -r  Refine the tour of each frame (see refineFrame), and report the change in draw time to stderr.
+//   -t  Time budget of the refinement, per frame. Refinement stops early when it is exceeded, making the output depend on
+//       the speed of the machine. Defaults to REFINE_BUDGET_MS.
+
+// Frame
+// - Input points of a frame, the order in which they are visited, and the points that are kept.
+// - Points are visited as one or more polylines, each a range of the order.
+struct frame
+{
+    int pointCount;
+    int* x;
+    int* y;
+    int* order;
+    int orderCount;
+    int* breaks;                         // Position in the order of the first point of each polyline.
+    int breakCount;
+    xyPoint_t* points;
+    uint16_t count;
+    uint16_t* pointBreaks;               // Index of the first kept point of each polyline.
+    uint16_t pointBreakCount;
+    double tolerance;                    // Tolerance the frame was simplified with.
+    uint32_t drawUs;                     // Draw time of the kept points, before refinement.
+    uint32_t refinedUs;                  // Draw time of the kept points, after refinement.
+};
+
+// Grid
+// - Spatial index of the points of a frame that have yet to be visited. Points are bucketed into square cells, each cell's
+//   points are stored contiguously so removing one is a swap with the cell's last point.
+struct grid
+{
+    int minX;
+    int minY;
+    int cellSize;
+    int width;
+    int height;
+    int* cellStart;                      // Index of the first point of each cell in cells.
+    int* cellCount;                      // Number of points left in each cell.
+    int* cells;                          // Point indices, grouped by cell.
+    int* slots;                          // Position of each point in cells.
+};
+
+// Pool
+// - Frames to be ordered by the worker threads, each thread takes the next frame until none are left.
+struct pool
+{
+    struct frame* frames;
+    int frameCount;
+    int next;
+    bool linear;
+    bool contours;
+    double tolerance;
+    uint32_t frameUs;                    // Longest draw time of a frame, 0 if unlimited.
+    bool refine;
+    uint32_t budgetMs;
+    pthread_mutex_t lock;
+};
+
+// Settling time of each move size, see xyGetMoveDelayUs
+uint16_t settlingTable[RC_TABLE_SIZE];
 
 int nearestNeighbor(int index, int* x, int* y, int pointCount, bool* pointsHit)
 {
@@ -28,82 +120,971 @@ int nearestNeighbor(int index, int* x, int* y, int pointCount, bool* pointsHit)
     return neighbor;
 }
 
-int main()
+int gridCell(struct grid* grid, int x, int y)
 {
-    int frameCount;
-    fscanf(stdin, "%i", &frameCount);
+    return (y - grid->minY) / grid->cellSize * grid->width + (x - grid->minX) / grid->cellSize;
+}
 
-    printf("#ifndef MODELS_H\n#define MODELS_H\n// Notice: This file is auto-generated. Any changes will be over-written on re-generation\n\n");
+void gridInit(struct grid* grid, int* x, int* y, int pointCount)
+{
+    int maxX = x[0];
+    int maxY = y[0];
+    grid->minX = x[0];
+    grid->minY = y[0];
+    for(int index = 1; index < pointCount; ++index)
+    {
+        if(x[index] < grid->minX) grid->minX = x[index];
+        if(y[index] < grid->minY) grid->minY = y[index];
+        if(x[index] > maxX) maxX = x[index];
+        if(y[index] > maxY) maxY = y[index];
+    }
 
-    for(int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+    // Cell size giving roughly GRID_CELL_POINTS points per cell, were the points spread over the whole bounding box
+    int area = (maxX - grid->minX + 1) * (maxY - grid->minY + 1);
+    grid->cellSize = 1;
+    while(grid->cellSize * grid->cellSize * pointCount < area * GRID_CELL_POINTS) ++grid->cellSize;
+
+    grid->width = (maxX - grid->minX) / grid->cellSize + 1;
+    grid->height = (maxY - grid->minY) / grid->cellSize + 1;
+
+    int cellTotal = grid->width * grid->height;
+    grid->cellStart = calloc(cellTotal + 1, sizeof(int));
+    grid->cellCount = calloc(cellTotal, sizeof(int));
+    grid->cells = malloc(sizeof(int) * pointCount);
+    grid->slots = malloc(sizeof(int) * pointCount);
+
+    // Bucket the points by cell, in order of index
+    for(int index = 0; index < pointCount; ++index) ++grid->cellCount[gridCell(grid, x[index], y[index])];
+    for(int cell = 0; cell < cellTotal; ++cell) grid->cellStart[cell + 1] = grid->cellStart[cell] + grid->cellCount[cell];
+
+    memset(grid->cellCount, 0, sizeof(int) * cellTotal);
+    for(int index = 0; index < pointCount; ++index)
     {
-        int pointCount;
-        fscanf(stdin, "%i\n[", &pointCount);
+        int cell = gridCell(grid, x[index], y[index]);
+        int slot = grid->cellStart[cell] + grid->cellCount[cell]++;
+        grid->cells[slot] = index;
+        grid->slots[index] = slot;
+    }
+}
+
+void gridFree(struct grid* grid)
+{
+    free(grid->cellStart);
+    free(grid->cellCount);
+    free(grid->cells);
+    free(grid->slots);
+}
+
+void gridRemove(struct grid* grid, int index, int* x, int* y)
+{
+    int cell = gridCell(grid, x[index], y[index]);
+    int slot = grid->slots[index];
+    int last = grid->cellStart[cell] + --grid->cellCount[cell];
+
+    grid->cells[slot] = grid->cells[last];
+    grid->slots[grid->cells[slot]] = slot;
+    grid->cells[last] = index;
+    grid->slots[index] = last;
+}
+
+// Grid Nearest Neighbor
+// - Same result as nearestNeighbor: the closest remaining point, ties going to the lowest index.
+// - Cells are searched in rings of increasing distance from the point's cell. Every point beyond ring r is more than
+//   r * cellSize away on some axis, so the search stops once the best distance is within that bound.
+int gridNearestNeighbor(struct grid* grid, int index, int* x, int* y)
+{
+    int bestDistance = -1;
+    int neighbor = -1;
+
+    int cellX = (x[index] - grid->minX) / grid->cellSize;
+    int cellY = (y[index] - grid->minY) / grid->cellSize;
+    int ringMax = grid->width > grid->height ? grid->width : grid->height;
 
-        if(pointCount == 0)
+    for(int ring = 0; ring < ringMax; ++ring)
+    {
+        for(int rowY = cellY - ring; rowY <= cellY + ring; ++rowY)
         {
-            fscanf(stdin, "]");
-            printf("#define SIZE_FRAME_%i 0\nxyPoint_t* const frame%i = NULL;\n\n", frameIndex, frameIndex);
-            continue;
+            if(rowY < 0 || rowY >= grid->height) continue;
+
+            // Whole row on the top and bottom of the ring, only the 2 ends on the sides
+            bool edge = rowY == cellY - ring || rowY == cellY + ring;
+            int step = edge || ring == 0 ? 1 : 2 * ring;
+
+            for(int columnX = cellX - ring; columnX <= cellX + ring; columnX += step)
+            {
+                if(columnX < 0 || columnX >= grid->width) continue;
+
+                int cell = rowY * grid->width + columnX;
+                for(int slot = grid->cellStart[cell]; slot < grid->cellStart[cell] + grid->cellCount[cell]; ++slot)
+                {
+                    int neighborIndex = grid->cells[slot];
+
+                    int deltaX = x[index] - x[neighborIndex];
+                    int deltaY = y[index] - y[neighborIndex];
+
+                    int distance = deltaX * deltaX + deltaY * deltaY;
+
+                    if(distance < bestDistance || bestDistance == -1 || (distance == bestDistance && neighborIndex < neighbor))
+                    {
+                        neighbor = neighborIndex;
+                        bestDistance = distance;
+                    }
+                }
+            }
         }
 
-        int actualPointCount = pointCount / POINT_CULL_MODULUS;
-        printf("#define SIZE_FRAME_%i %i\nxyPoint_t frame%i[SIZE_FRAME_%i] = \n{", frameIndex, actualPointCount, frameIndex, frameIndex);
+        int bound = ring * grid->cellSize + 1;
+        if(neighbor != -1 && bestDistance < bound * bound) break;
+    }
+
+    return neighbor;
+}
+
+// Order Frame
+// - Greedy nearest neighbor tour of the frame's points, starting from the first.
+void orderFrame(struct frame* frame, bool linear)
+{
+    int pointCount = frame->pointCount;
+    frame->order = malloc(sizeof(int) * (pointCount > 0 ? pointCount : 1));
+    frame->orderCount = pointCount > 0 ? pointCount : 0;
+    frame->breaks = malloc(sizeof(int));
+    frame->breaks[0] = 0;
+    frame->breakCount = pointCount > 0 ? 1 : 0;
+    if(pointCount <= 0) return;
 
-        // Points to work with
-        int* xIn = malloc(sizeof(int) * pointCount);
-        int* yIn = malloc(sizeof(int) * pointCount);
+    // Indicates whether a point has been traversed
+    bool* pointsHit = NULL;
+    struct grid grid;
 
-        // Total number of points traversed
-        int pointsHitTotal;
+    if(linear)
+    {
+        pointsHit = calloc(pointCount, sizeof(bool));
+    }
+    else
+    {
+        gridInit(&grid, frame->x, frame->y, pointCount);
+    }
 
-        // Indicates whether a point has been traversed
-        bool* pointsHit = malloc(sizeof(bool) * pointCount);
+    // Mark first point
+    int currentIndex = 0;
+    frame->order[0] = 0;
+    if(linear) pointsHit[0] = true;
+    else gridRemove(&grid, 0, frame->x, frame->y);
 
-        // Get input
-        for(int index = 0; index < pointCount; ++index)
+    for(int pointsHitTotal = 1; pointsHitTotal < pointCount; ++pointsHitTotal)
+    {
+        // Find next point
+        if(linear)
         {
-            fscanf(stdin, "(%i, %i), ", &xIn[index], &yIn[index]);
-            pointsHit[index] = false;
+            currentIndex = nearestNeighbor(currentIndex, frame->x, frame->y, pointCount, pointsHit);
+            pointsHit[currentIndex] = true;
         }
+        else
+        {
+            currentIndex = gridNearestNeighbor(&grid, currentIndex, frame->x, frame->y);
+            gridRemove(&grid, currentIndex, frame->x, frame->y);
+        }
+
+        frame->order[pointsHitTotal] = currentIndex;
+    }
+
+    if(linear) free(pointsHit);
+    else gridFree(&grid);
+}
 
-        // Mark first point
-        pointsHit[0] = true;
-        pointsHitTotal = 1;
-        int currentIndex = 0;
+// Trace Frame
+// - Replaces the frame's points with the pixels they cover, ordered into polylines that follow the edges.
+// - Pixels are followed through their 8 neighbors, preferring the 4 direct ones so corners are not cut. Contours are
+//   started from their endpoints where possible, closed contours from their first pixel in row-major order. Contours
+//   shorter than CONTOUR_LENGTH_MIN are dropped.
+// - Polylines are then ordered greedily, each starting from whichever end is closest to the end of the previous one.
+void traceFrame(struct frame* frame)
+{
+    static const int offsetsX[8] = { 1, 0, -1, 0, 1, -1, -1, 1 };
+    static const int offsetsY[8] = { 0, 1, 0, -1, 1, 1, -1, -1 };
+
+    int pointCount = frame->pointCount;
+    frame->order = malloc(sizeof(int) * (pointCount > 0 ? pointCount : 1));
+    frame->orderCount = 0;
+    frame->breaks = malloc(sizeof(int) * (pointCount > 0 ? pointCount : 1));
+    frame->breakCount = 0;
+    if(pointCount <= 0) return;
 
-        if(POINT_CULL_MODULUS == 1)
+    // Raster of the points, 0 for empty, 1 for untraced, 2 for traced
+    int minX = frame->x[0], maxX = frame->x[0], minY = frame->y[0], maxY = frame->y[0];
+    for(int index = 1; index < pointCount; ++index)
+    {
+        if(frame->x[index] < minX) minX = frame->x[index];
+        if(frame->x[index] > maxX) maxX = frame->x[index];
+        if(frame->y[index] < minY) minY = frame->y[index];
+        if(frame->y[index] > maxY) maxY = frame->y[index];
+    }
+
+    int width = maxX - minX + 1;
+    int height = maxY - minY + 1;
+    uint8_t* raster = calloc(width * height, 1);
+    for(int index = 0; index < pointCount; ++index) raster[(frame->y[index] - minY) * width + frame->x[index] - minX] = 1;
+
+    // Traced pixels, contour by contour
+    int* x = malloc(sizeof(int) * pointCount);
+    int* y = malloc(sizeof(int) * pointCount);
+    int* starts = malloc(sizeof(int) * (pointCount + 1));
+    int contourCount = 0;
+    int tracedCount = 0;
+
+    for(int pass = 0; pass < 2; ++pass)
+    {
+        for(int pixel = 0; pixel < width * height; ++pixel)
         {
-            printf("\n    {%i, %i}, ", xIn[0], yIn[0]);
+            if(raster[pixel] != 1) continue;
+
+            int currentX = pixel % width;
+            int currentY = pixel / width;
+
+            // First pass only starts from endpoints
+            if(pass == 0)
+            {
+                int neighbors = 0;
+                for(int offset = 0; offset < 8; ++offset)
+                {
+                    int neighborX = currentX + offsetsX[offset];
+                    int neighborY = currentY + offsetsY[offset];
+                    if(neighborX >= 0 && neighborX < width && neighborY >= 0 && neighborY < height && raster[neighborY * width + neighborX] == 1) ++neighbors;
+                }
+
+                if(neighbors > 1) continue;
+            }
+
+            int start = tracedCount;
+            while(true)
+            {
+                raster[currentY * width + currentX] = 2;
+                x[tracedCount] = currentX + minX;
+                y[tracedCount] = currentY + minY;
+                ++tracedCount;
+
+                int offset = 0;
+                for(; offset < 8; ++offset)
+                {
+                    int neighborX = currentX + offsetsX[offset];
+                    int neighborY = currentY + offsetsY[offset];
+                    if(neighborX >= 0 && neighborX < width && neighborY >= 0 && neighborY < height && raster[neighborY * width + neighborX] == 1) break;
+                }
+                if(offset == 8) break;
+
+                currentX += offsetsX[offset];
+                currentY += offsetsY[offset];
+            }
+
+            if(tracedCount - start < CONTOUR_LENGTH_MIN) tracedCount = start;
+            else starts[contourCount++] = start;
         }
-        else
+    }
+    starts[contourCount] = tracedCount;
+    free(raster);
+
+    // Order the contours, nearest end first
+    bool* contoursUsed = calloc(contourCount > 0 ? contourCount : 1, sizeof(bool));
+    int currentX = contourCount != 0 ? x[0] : 0;
+    int currentY = contourCount != 0 ? y[0] : 0;
+
+    for(int ordered = 0; ordered < contourCount; ++ordered)
+    {
+        int best = -1;
+        int bestDistance = 0;
+        bool bestReversed = false;
+
+        for(int contour = 0; contour < contourCount; ++contour)
         {
-            printf("\n    ");
+            if(contoursUsed[contour]) continue;
+
+            for(int end = 0; end < 2; ++end)
+            {
+                int point = end == 0 ? starts[contour] : starts[contour + 1] - 1;
+                int deltaX = x[point] - currentX;
+                int deltaY = y[point] - currentY;
+                int distance = deltaX * deltaX + deltaY * deltaY;
+
+                if(best == -1 || distance < bestDistance)
+                {
+                    best = contour;
+                    bestDistance = distance;
+                    bestReversed = end == 1;
+                }
+            }
         }
 
-        while(pointsHitTotal < pointCount)
+        contoursUsed[best] = true;
+        frame->breaks[frame->breakCount++] = frame->orderCount;
+
+        int length = starts[best + 1] - starts[best];
+        for(int index = 0; index < length; ++index)
         {
-            if(pointsHitTotal % (8 * POINT_CULL_MODULUS) == 0) printf("\n    ");
+            frame->order[frame->orderCount++] = bestReversed ? starts[best + 1] - 1 - index : starts[best] + index;
+        }
 
-            // Find next point
-            currentIndex = nearestNeighbor(currentIndex, xIn, yIn, pointCount, pointsHit);
-            pointsHit[currentIndex] = true;
-            ++pointsHitTotal;
+        int last = frame->order[frame->orderCount - 1];
+        currentX = x[last];
+        currentY = y[last];
+    }
+
+    free(contoursUsed);
+    free(starts);
+    free(frame->x);
+    free(frame->y);
+    frame->x = x;
+    frame->y = y;
+    frame->pointCount = tracedCount;
+}
+
+// Move Cost
+// - Time for the beam to settle after moving between 2 points, same as xyGetMoveDelayUs.
+int moveCost(xyPoint_t a, xyPoint_t b)
+{
+    int deltaX = abs(a.x - b.x);
+    int deltaY = abs(a.y - b.y);
+    int deltaMax = deltaX > deltaY ? deltaX : deltaY;
+
+    if(deltaMax >= RC_TABLE_SIZE) return xyRcSettlingUs(deltaMax, RC_CONSTANT_US, RC_PIXEL_THRES);
+    return settlingTable[deltaMax];
+}
+
+// Tour Cost
+// - Time to draw the points once. The frame is played in a loop, so this includes the move from the last point to the first.
+uint32_t tourCost(xyPoint_t* points, int count)
+{
+    uint32_t cost = 0;
+    for(int index = 0; index < count; ++index) cost += moveCost(points[index], points[(index + 1) % count]);
 
-            // Print point
-            if(pointsHitTotal % POINT_CULL_MODULUS == 0)
+    return cost;
+}
+
+// Frame Cost
+// - Time to draw the points once, including turning the beam on and off for each polyline.
+uint32_t frameCost(xyPoint_t* points, int count, int polylineCount)
+{
+    return count != 0 ? tourCost(points, count) + 2 * Z_DELAY_US * polylineCount : 0;
+}
+
+// Segment Distance
+// - Distance of point p from the segment between points a and b.
+double segmentDistance(int px, int py, int ax, int ay, int bx, int by)
+{
+    double deltaX = bx - ax;
+    double deltaY = by - ay;
+    double lengthSquared = deltaX * deltaX + deltaY * deltaY;
+
+    double t = lengthSquared == 0 ? 0 : ((px - ax) * deltaX + (py - ay) * deltaY) / lengthSquared;
+    if(t < 0) t = 0;
+    if(t > 1) t = 1;
+
+    return hypot(px - (ax + t * deltaX), py - (ay + t * deltaY));
+}
+
+int compareDouble(const void* a, const void* b)
+{
+    double difference = *(const double*)a - *(const double*)b;
+    return (difference > 0) - (difference < 0);
+}
+
+// Keep Points
+// - Collects the endpoints of each polyline and the points whose significance exceeds the tolerance, returns the draw time
+//   of the result.
+uint32_t keepPoints(struct frame* frame, double* significance, double tolerance)
+{
+    frame->count = 0;
+    frame->pointBreakCount = 0;
+
+    for(int polyline = 0; polyline < frame->breakCount; ++polyline)
+    {
+        int first = frame->breaks[polyline];
+        int last = (polyline + 1 < frame->breakCount ? frame->breaks[polyline + 1] : frame->orderCount) - 1;
+
+        frame->pointBreaks[frame->pointBreakCount++] = frame->count;
+
+        for(int index = first; index <= last; ++index)
+        {
+            if(significance[index] <= tolerance && index != first && index != last) continue;
+
+            int point = frame->order[index];
+            frame->points[frame->count++] = (xyPoint_t) { frame->x[point], frame->y[point] };
+        }
+    }
+
+    return frameCost(frame->points, frame->count, frame->pointBreakCount);
+}
+
+// Simplify Frame
+// - Reduces each polyline of the frame to the points needed to keep every point within the tolerance of the path
+//   (Ramer-Douglas-Peucker).
+// - Each point's significance is the largest tolerance at which Ramer-Douglas-Peucker would keep it, so simplifying at any
+//   tolerance is a filter. If the frame exceeds the draw time, the tolerance is raised to the lowest significance that
+//   fits, keeping as much detail as the draw time allows.
+void simplifyFrame(struct frame* frame, double tolerance, uint32_t frameUs)
+{
+    int orderCount = frame->orderCount;
+    frame->points = malloc(sizeof(xyPoint_t) * (orderCount > 0 ? orderCount : 1));
+    frame->count = 0;
+    frame->pointBreaks = malloc(sizeof(uint16_t) * (frame->breakCount > 0 ? frame->breakCount : 1));
+    frame->pointBreakCount = 0;
+    frame->tolerance = tolerance;
+
+    int* x = frame->x;
+    int* y = frame->y;
+    int* order = frame->order;
+
+    // Endpoints are always kept, they bound the significance of the first split of their polyline
+    double* significance = malloc(sizeof(double) * (orderCount > 0 ? orderCount : 1));
+    int* stack = malloc(sizeof(int) * 2 * (orderCount > 0 ? orderCount : 1));
+    int stackSize = 0;
+
+    for(int polyline = 0; polyline < frame->breakCount; ++polyline)
+    {
+        int first = frame->breaks[polyline];
+        int last = (polyline + 1 < frame->breakCount ? frame->breaks[polyline + 1] : orderCount) - 1;
+
+        significance[first] = INFINITY;
+        significance[last] = INFINITY;
+
+        if(last - first > 1)
+        {
+            stack[stackSize++] = first;
+            stack[stackSize++] = last;
+        }
+    }
+
+    // Split the sections of each polyline at their farthest point, each split being no more significant than its section's
+    while(stackSize != 0)
+    {
+        int last = stack[--stackSize];
+        int first = stack[--stackSize];
+
+        int farthest = first + 1;
+        double distanceMax = -1;
+        for(int index = first + 1; index < last; ++index)
+        {
+            double distance = segmentDistance(x[order[index]], y[order[index]], x[order[first]], y[order[first]], x[order[last]], y[order[last]]);
+            if(distance > distanceMax)
             {
-                printf("{%3i, %3i}, ", xIn[currentIndex], yIn[currentIndex]);
+                distanceMax = distance;
+                farthest = index;
             }
         }
 
-        free(xIn);
-        free(yIn);
-        free(pointsHit);
+        double bound = significance[first] < significance[last] ? significance[first] : significance[last];
+        significance[farthest] = distanceMax < bound ? distanceMax : bound;
+
+        if(farthest - first > 1)
+        {
+            stack[stackSize++] = first;
+            stack[stackSize++] = farthest;
+        }
+        if(last - farthest > 1)
+        {
+            stack[stackSize++] = farthest;
+            stack[stackSize++] = last;
+        }
+    }
+    free(stack);
+
+    uint32_t drawUs = keepPoints(frame, significance, tolerance);
+    if(frameUs != 0 && drawUs > frameUs)
+    {
+        // Binary search the sorted significances for the lowest tolerance that fits, the highest keeps only endpoints
+        double* sorted = malloc(sizeof(double) * orderCount);
+        int sortedCount = 0;
+        for(int index = 0; index < orderCount; ++index)
+        {
+            if(significance[index] != INFINITY) sorted[sortedCount++] = significance[index];
+        }
+        qsort(sorted, sortedCount, sizeof(double), compareDouble);
+
+        if(sortedCount != 0)
+        {
+            int low = 0;
+            int high = sortedCount - 1;
+            while(low < high)
+            {
+                int middle = (low + high) / 2;
+                if(sorted[middle] > tolerance && keepPoints(frame, significance, sorted[middle]) <= frameUs) high = middle;
+                else low = middle + 1;
+            }
+
+            frame->tolerance = sorted[low] > tolerance ? sorted[low] : tolerance;
+            keepPoints(frame, significance, frame->tolerance);
+        }
+
+        free(sorted);
+    }
+
+    free(significance);
+    free(x);
+    free(y);
+    free(order);
+    free(frame->breaks);
+}
+
+double timeMs()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec * 1e3 + time.tv_nsec * 1e-6;
+}
+
+// Reverse Tour
+// - Reverses the points from position first to last (inclusive), wrapping around the end of the tour.
+void reverseTour(int* tour, int* positions, int count, int first, int last)
+{
+    int length = (last - first + count) % count + 1;
+
+    for(int swap = 0; swap < length / 2; ++swap)
+    {
+        int a = (first + swap) % count;
+        int b = (last - swap + count) % count;
+
+        int temp = tour[a];
+        tour[a] = tour[b];
+        tour[b] = temp;
+        positions[tour[a]] = a;
+        positions[tour[b]] = b;
+    }
+}
+
+// Two-Opt Move
+// - Replaces the moves (tour[i], tour[i + 1]) and (tour[j], tour[j + 1]) with (tour[i], tour[j]) and (tour[i + 1],
+//   tour[j + 1]), if doing so is cheaper. Returns whether the move was made.
+bool twoOptMove(xyPoint_t* points, int* tour, int* positions, int count, int i, int j)
+{
+    int a = tour[i];
+    int b = tour[(i + 1) % count];
+    int c = tour[j];
+    int d = tour[(j + 1) % count];
+    if(a == c || b == c || a == d) return false;
+
+    int gain = moveCost(points[a], points[b]) + moveCost(points[c], points[d]) - moveCost(points[a], points[c]) - moveCost(points[b], points[d]);
+    if(gain <= 0) return false;
+
+    // Reverse whichever side is shorter, the tour is a loop and costs are symmetric
+    if((j - i + count) % count <= count / 2) reverseTour(tour, positions, count, (i + 1) % count, j);
+    else reverseTour(tour, positions, count, (j + 1) % count, i);
+
+    return true;
+}
+
+// Or-Opt Move
+// - Moves the segment of the specified length starting at position first between points c and d (adjacent in the tour),
+//   in whichever direction is cheaper, if doing so is cheaper. Returns whether the move was made.
+bool orOptMove(xyPoint_t* points, int* tour, int* positions, int count, int first, int length, int c, int d)
+{
+    int start = tour[first];
+    int end = tour[(first + length - 1) % count];
+    int previous = tour[(first - 1 + count) % count];
+    int next = tour[(first + length) % count];
+
+    // c and d must both lie outside the segment
+    for(int offset = 0; offset < length; ++offset)
+    {
+        int point = tour[(first + offset) % count];
+        if(point == c || point == d) return false;
+    }
+
+    int removeGain = moveCost(points[previous], points[start]) + moveCost(points[end], points[next]) - moveCost(points[previous], points[next]);
+    int forwardCost = moveCost(points[c], points[start]) + moveCost(points[end], points[d]);
+    int reverseCost = moveCost(points[c], points[end]) + moveCost(points[start], points[d]);
+    bool reversed = reverseCost < forwardCost;
+
+    int gain = removeGain + moveCost(points[c], points[d]) - (reversed ? reverseCost : forwardCost);
+    if(gain <= 0) return false;
+
+    // Rebuild the tour from the segment's successor
+    int* segment = malloc(sizeof(int) * length);
+    for(int offset = 0; offset < length; ++offset) segment[offset] = tour[(first + offset) % count];
+
+    int* rebuilt = malloc(sizeof(int) * count);
+    int size = 0;
+    for(int offset = 0; offset < count - length; ++offset)
+    {
+        int point = tour[(first + length + offset) % count];
+        rebuilt[size++] = point;
+
+        if(point == c)
+        {
+            for(int index = 0; index < length; ++index) rebuilt[size++] = segment[reversed ? length - 1 - index : index];
+        }
+    }
+
+    for(int index = 0; index < count; ++index)
+    {
+        tour[index] = rebuilt[index];
+        positions[tour[index]] = index;
+    }
+
+    free(segment);
+    free(rebuilt);
+    return true;
+}
+
+// Refine Frame
+// - Improves the tour of the points with 2-opt and Or-opt moves, until no move improves it or the time budget runs out.
+// - The cost of a tour is its draw time under the RC timing of the animation example, not its length. Each point only
+//   considers its REFINE_NEIGHBORS cheapest neighbors as new neighbors in the tour.
+// - The tour still starts with the same point.
+void refineFrame(xyPoint_t* points, int count, uint32_t budgetMs)
+{
+    if(count < 5) return;
+
+    double deadline = timeMs() + budgetMs;
+    int neighborCount = count - 1 < REFINE_NEIGHBORS ? count - 1 : REFINE_NEIGHBORS;
+
+    // Neighbor lists, by cost then distance
+    int* neighbors = malloc(sizeof(int) * count * neighborCount);
+    int* keys = malloc(sizeof(int) * count);
+    for(int point = 0; point < count; ++point)
+    {
+        for(int other = 0; other < count; ++other)
+        {
+            int deltaX = points[point].x - points[other].x;
+            int deltaY = points[point].y - points[other].y;
+            keys[other] = other == point ? -1 : moveCost(points[point], points[other]) * 0x400000 + deltaX * deltaX + deltaY * deltaY;
+        }
+
+        // Partial selection sort, neighbor lists are short
+        int* list = &neighbors[point * neighborCount];
+        for(int rank = 0; rank < neighborCount; ++rank)
+        {
+            int best = -1;
+            for(int other = 0; other < count; ++other)
+            {
+                if(keys[other] >= 0 && (best == -1 || keys[other] < keys[best])) best = other;
+            }
+
+            list[rank] = best;
+            keys[best] = -1;
+        }
+    }
+    free(keys);
+
+    int* tour = malloc(sizeof(int) * count);
+    int* positions = malloc(sizeof(int) * count);
+    for(int index = 0; index < count; ++index)
+    {
+        tour[index] = index;
+        positions[index] = index;
+    }
+
+    bool improved = true;
+    while(improved && timeMs() < deadline)
+    {
+        improved = false;
+
+        for(int a = 0; a < count && timeMs() < deadline; ++a)
+        {
+            for(int rank = 0; rank < neighborCount; ++rank)
+            {
+                int c = neighbors[a * neighborCount + rank];
+
+                // 2-opt, making a and c adjacent after either's successor or predecessor
+                if(twoOptMove(points, tour, positions, count, positions[a], positions[c]))
+                {
+                    improved = true;
+                    continue;
+                }
+                if(twoOptMove(points, tour, positions, count, (positions[a] - 1 + count) % count, (positions[c] - 1 + count) % count))
+                {
+                    improved = true;
+                    continue;
+                }
+
+                // Or-opt, moving a segment starting or ending at a next to c
+                for(int length = 1; length <= REFINE_SEGMENT_MAX && length < count - 2; ++length)
+                {
+                    int successor = tour[(positions[c] + 1) % count];
+                    int predecessor = tour[(positions[c] - 1 + count) % count];
+                    int starting = positions[a];
+                    int ending = (positions[a] - length + 1 + count) % count;
+
+                    if(orOptMove(points, tour, positions, count, starting, length, c, successor) ||
+                        orOptMove(points, tour, positions, count, starting, length, predecessor, c) ||
+                        orOptMove(points, tour, positions, count, ending, length, c, successor) ||
+                        orOptMove(points, tour, positions, count, ending, length, predecessor, c))
+                    {
+                        improved = true;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    // Rotate the tour back to its first point
+    xyPoint_t* refined = malloc(sizeof(xyPoint_t) * count);
+    for(int index = 0; index < count; ++index) refined[index] = points[tour[(positions[0] + index) % count]];
+    memcpy(points, refined, sizeof(xyPoint_t) * count);
+
+    free(refined);
+    free(tour);
+    free(positions);
+    free(neighbors);
+}
+
+void* poolWorker(void* argument)
+{
+    struct pool* pool = argument;
+
+    while(true)
+    {
+        pthread_mutex_lock(&pool->lock);
+        int frameIndex = pool->next++;
+        pthread_mutex_unlock(&pool->lock);
+
+        if(frameIndex >= pool->frameCount) return NULL;
+
+        struct frame* frame = &pool->frames[frameIndex];
+        if(pool->contours) traceFrame(frame);
+        else orderFrame(frame, pool->linear);
+        simplifyFrame(frame, pool->tolerance, pool->frameUs);
+
+        // Refinement treats the frame as a single tour, polylines are left as traced
+        frame->drawUs = frameCost(frame->points, frame->count, frame->pointBreakCount);
+        if(pool->refine && frame->pointBreakCount == 1) refineFrame(frame->points, frame->count, pool->budgetMs);
+        frame->refinedUs = frameCost(frame->points, frame->count, frame->pointBreakCount);
+    }
+}
+
+// Print Breaks
+// - Outputs the index of the first point of each polyline of each frame (see '-c').
+void printBreaks(struct frame* frames, int frameCount)
+{
+    for(int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+    {
+        struct frame* frame = &frames[frameIndex];
+
+        if(frame->count == 0)
+        {
+            printf("#define BREAKS_FRAME_%i 0\nconst uint16_t* const frameBreaks%i = NULL;\n\n", frameIndex, frameIndex);
+            continue;
+        }
+
+        printf("#define BREAKS_FRAME_%i %i\nconst uint16_t frameBreaks%i[BREAKS_FRAME_%i] = \n{\n    ", frameIndex, frame->pointBreakCount, frameIndex, frameIndex);
+
+        for(int index = 0; index < frame->pointBreakCount; ++index)
+        {
+            if(index % 16 == 0 && index != 0) printf("\n    ");
+            printf("%i, ", frame->pointBreaks[index]);
+        }
+
+        printf("\n};\n\n");
+    }
+
+    printf("const uint16_t* frameBreaks[FRAME_COUNT] = \n{");
+    for(int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+    {
+        if(frameIndex % 8 == 0) printf("\n    ");
+
+        printf("frameBreaks%i", frameIndex);
+
+        if(frameIndex != frameCount - 1) printf(", ");
+    }
+    printf("\n};\n\n");
+
+    printf("uint16_t frameBreakCounts[FRAME_COUNT] = \n{");
+    for(int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+    {
+        if(frameIndex % 8 == 0) printf("\n    ");
+
+        printf("BREAKS_FRAME_%i", frameIndex);
+
+        if(frameIndex != frameCount - 1) printf(", ");
+    }
+    printf("\n};\n\n");
+}
+
+// Packed mode ('-b'): frames are encoded in the format of 'xy_packed.h' and emitted as a single byte array, to be played
+// with xyRenderPacked.
+void printPacked(xyPoint_t** frames, uint16_t* frameSizes, int frameCount, struct frame* breakFrames)
+{
+    uint32_t size = xyPackedAnimationSize(frames, frameSizes, frameCount);
+    uint8_t* animation = malloc(size);
+    xyPackedEncodeAnimation(frames, frameSizes, frameCount, animation);
+
+    uint32_t pointTotal = 0;
+    for(int frameIndex = 0; frameIndex < frameCount; ++frameIndex) pointTotal += frameSizes[frameIndex];
+
+    printf("#ifndef MODELS_PACKED_H\n#define MODELS_PACKED_H\n// Notice: This file is auto-generated. Any changes will be over-written on re-generation\n\n");
+    printf("// %u points in %u bytes (%u bytes unpacked)\n\n", pointTotal, size, pointTotal * (unsigned)sizeof(xyPoint_t));
+    printf("#define FRAME_COUNT %i\nconst uint8_t animation[%u] = \n{", frameCount, size);
+    for(uint32_t index = 0; index < size; ++index)
+    {
+        if(index % 16 == 0) printf("\n    ");
+
+        printf("0x%02X", animation[index]);
+
+        if(index != size - 1) printf(", ");
+    }
+    printf("\n};\n\n");
+
+    if(breakFrames != NULL) printBreaks(breakFrames, frameCount);
+
+    printf("#endif // MODELS_PACKED_H\n");
+
+    free(animation);
+}
+
+// Print Report
+// - Outputs the result of the simplification, and the change in draw time of each frame due to refinement, to stderr.
+void printReport(struct frame* frames, int frameCount, double tolerance, uint32_t frameUs, bool refine, uint32_t budgetMs)
+{
+    uint64_t pointTotal = 0;
+    uint64_t keptTotal = 0;
+    uint64_t polylineTotal = 0;
+    uint64_t drawTotal = 0;
+    uint64_t drawMax = 0;
+    uint64_t refinedTotal = 0;
+    int raisedCount = 0;
+    int overCount = 0;
+    double* reductions = malloc(sizeof(double) * (frameCount > 0 ? frameCount : 1));
+    int reductionCount = 0;
+
+    for(int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+    {
+        struct frame* frame = &frames[frameIndex];
+
+        pointTotal += frame->pointCount;
+        keptTotal += frame->count;
+        polylineTotal += frame->pointBreakCount;
+        drawTotal += frame->drawUs;
+        refinedTotal += frame->refinedUs;
+        if(frame->refinedUs > drawMax) drawMax = frame->refinedUs;
+        if(frame->tolerance > tolerance) ++raisedCount;
+        if(frameUs != 0 && frame->refinedUs > frameUs) ++overCount;
+
+        if(frame->drawUs != 0) reductions[reductionCount++] = 100.0 * (1.0 - (double)frame->refinedUs / frame->drawUs);
+    }
+
+    fprintf(stderr, "# Simplification, tolerance %.2f px, RC constant %ius, threshold %i", tolerance, RC_CONSTANT_US, RC_PIXEL_THRES);
+    if(frameUs != 0) fprintf(stderr, ", frame limit %uus", frameUs);
+    fprintf(stderr, "\nframes %i, polylines %llu, points %llu -> %llu, mean draw time %.1f us, max %llu us, %i frames above the tolerance\n", frameCount,
+        (unsigned long long)polylineTotal, (unsigned long long)pointTotal, (unsigned long long)keptTotal, frameCount != 0 ? (double)refinedTotal / frameCount : 0.0,
+        (unsigned long long)drawMax, raisedCount);
+    if(overCount != 0) fprintf(stderr, "%i frames exceed the frame limit with only the endpoints of their polylines\n", overCount);
+
+    if(refine)
+    {
+        // Sort the reductions for percentiles
+        for(int index = 1; index < reductionCount; ++index)
+        {
+            double reduction = reductions[index];
+            int position = index;
+            for(; position > 0 && reductions[position - 1] > reduction; --position) reductions[position] = reductions[position - 1];
+            reductions[position] = reduction;
+        }
+
+        fprintf(stderr, "# Refinement, budget %ums per frame\n", budgetMs);
+        fprintf(stderr, "draw time %llu us -> %llu us", (unsigned long long)drawTotal, (unsigned long long)refinedTotal);
+        if(drawTotal != 0) fprintf(stderr, " (-%.1f%%)", 100.0 * (1.0 - (double)refinedTotal / drawTotal));
+        fprintf(stderr, "\n");
+
+        if(reductionCount != 0)
+        {
+            fprintf(stderr, "per frame reduction: min %.1f%%, median %.1f%%, p90 %.1f%%, max %.1f%%\n", reductions[0],
+                reductions[reductionCount / 2], reductions[reductionCount * 9 / 10], reductions[reductionCount - 1]);
+        }
+    }
+
+    free(reductions);
+}
+
+int main(int argc, char** argv)
+{
+    bool packed = false;
+    bool linear = false;
+    bool contours = false;
+    bool refine = false;
+    double tolerance = SIMPLIFY_TOLERANCE;
+    uint32_t frameUs = 0;
+    uint32_t budgetMs = REFINE_BUDGET_MS;
+    int threadCount = sysconf(_SC_NPROCESSORS_ONLN);
+
+    for(int index = 1; index < argc; ++index)
+    {
+        if(strcmp(argv[index], "-b") == 0) packed = true;
+        else if(strcmp(argv[index], "-c") == 0) contours = true;
+        else if(strcmp(argv[index], "-l") == 0) linear = true;
+        else if(strcmp(argv[index], "-r") == 0) refine = true;
+        else if(strcmp(argv[index], "-j") == 0 && index + 1 < argc) threadCount = atoi(argv[++index]);
+        else if(strcmp(argv[index], "-t") == 0 && index + 1 < argc) budgetMs = atoi(argv[++index]);
+        else if(strcmp(argv[index], "-e") == 0 && index + 1 < argc) tolerance = atof(argv[++index]);
+        else if(strcmp(argv[index], "-f") == 0 && index + 1 < argc) frameUs = 1000000 / atof(argv[++index]);
+    }
+    if(threadCount < 1) threadCount = 1;
+
+    xyRcSettlingTable(settlingTable, RC_TABLE_SIZE, RC_CONSTANT_US, RC_PIXEL_THRES);
+
+    int frameCount;
+    fscanf(stdin, "%i", &frameCount);
+
+    // Get input
+    struct frame* frames = malloc(sizeof(struct frame) * frameCount);
+    for(int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+    {
+        struct frame* frame = &frames[frameIndex];
+
+        fscanf(stdin, "%i\n[", &frame->pointCount);
+        frame->x = malloc(sizeof(int) * (frame->pointCount > 0 ? frame->pointCount : 1));
+        frame->y = malloc(sizeof(int) * (frame->pointCount > 0 ? frame->pointCount : 1));
+
+        for(int index = 0; index < frame->pointCount; ++index) fscanf(stdin, "(%i, %i), ", &frame->x[index], &frame->y[index]);
 
         fscanf(stdin, "]\n");
+    }
+
+    // Order the frames in parallel
+    struct pool pool = { frames, frameCount, 0, linear, contours, tolerance, frameUs, refine, budgetMs };
+    pthread_mutex_init(&pool.lock, NULL);
+
+    pthread_t* threads = malloc(sizeof(pthread_t) * threadCount);
+    for(int index = 0; index < threadCount; ++index) pthread_create(&threads[index], NULL, poolWorker, &pool);
+    for(int index = 0; index < threadCount; ++index) pthread_join(threads[index], NULL);
+    free(threads);
+
+    printReport(frames, frameCount, tolerance, frameUs, refine, budgetMs);
+
+    // Points of each frame, kept for packing
+    xyPoint_t** packedFrames = malloc(sizeof(xyPoint_t*) * frameCount);
+    uint16_t* packedSizes = malloc(sizeof(uint16_t) * frameCount);
+
+    if(!packed) printf("#ifndef MODELS_H\n#define MODELS_H\n// Notice: This file is auto-generated. Any changes will be over-written on re-generation\n\n");
+
+    for(int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+    {
+        struct frame* frame = &frames[frameIndex];
+        packedFrames[frameIndex] = frame->points;
+        packedSizes[frameIndex] = frame->count;
+
+        if(packed) continue;
+
+        if(frame->count == 0)
+        {
+            printf("#define SIZE_FRAME_%i 0\nxyPoint_t* const frame%i = NULL;\n\n", frameIndex, frameIndex);
+            continue;
+        }
+
+        printf("#define SIZE_FRAME_%i %i\nxyPoint_t frame%i[SIZE_FRAME_%i] = \n{\n    ", frameIndex, frame->count, frameIndex, frameIndex);
+
+        for(int index = 0; index < frame->count; ++index)
+        {
+            if(index % 8 == 0 && index != 0) printf("\n    ");
+            printf("{%3i, %3i}, ", frame->points[index].x, frame->points[index].y);
+        }
 
         printf("\n};\n\n");
+
+    }
+
+    if(packed)
+    {
+        printPacked(packedFrames, packedSizes, frameCount, contours ? frames : NULL);
+        return 0;
     }
 
     printf("#define FRAME_COUNT %i\nxyPoint_t* frames[FRAME_COUNT] = \n{", frameCount);
@@ -128,5 +1109,7 @@ int main()
     }
     printf("\n};\n\n");
 
+    if(contours) printBreaks(frames, frameCount);
+
     printf("#endif // MODELS_H\n");
 }
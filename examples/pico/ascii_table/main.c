@@ -64,6 +64,9 @@ int main()
         }
     }
 
+    // Display scene
+    xyRendererCommit();
+
     // Spin
     while(1);
 }
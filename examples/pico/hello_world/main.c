@@ -42,6 +42,9 @@ int main()
     // Write message
     xyRenderString("HELLO,WORLD!", xyScreenWidth() / 2 - 0x30, xyScreenHeight() / 2 - 0x14, xyScreenWidth() / 2 + 0x30, xyScreenHeight() / 2 + 0x14);
 
+    // Display scene
+    xyRendererCommit();
+
     // Spin
     while(1);
 }
@@ -68,6 +68,7 @@ int main()
 
     // Render model
     volatile xyShape_t* shape = xyRenderShape(model, modelSize, 0, 0, true);
+    xyRendererCommit();
 
     while(true);
 }
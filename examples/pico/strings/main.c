@@ -68,6 +68,11 @@ int main()
         "right  "
         "block! ", 0x90, 0x00, 0x100, 0x80);
 
+    // Display scene
+    // - Optimizing the render order minimizes the time the beam spends moving between shapes.
+    xyRendererOptimize();
+    xyRendererCommit();
+
     // Spin
     while(1);
 }
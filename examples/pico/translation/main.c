@@ -84,15 +84,12 @@ int main()
     // Rendering --------------------------------------------------------------------------------------------------------------
 
     // Render rotating square 1
-    // - The shape is rotating, therefore a buffer is required. A translated copy of the original model is copied into the
-    //   buffer, which is what is actually rendered. The result of the render function is disregarded, as this shaped doesn't
-    //   need moved.
-    xyPoint_t square1Buffer[SIZE_SQUARE_MODEL];
-    xyRenderShape(square1Buffer, SIZE_SQUARE_MODEL, 8, 8, true);
+    // - The shape is rotating, which is done through the shape's transform. The renderer applies the transform to the original
+    //   model, so no buffer is required. The shape handler ('square1') is stored so it may be used to update the transform.
+    volatile xyShape_t* square1 = xyRenderShape(squareModel, SIZE_SQUARE_MODEL, 8, 8, true);
 
     // Render rotating square 2
-    xyPoint_t square2Buffer[SIZE_SQUARE_MODEL];
-    xyRenderShape(square2Buffer, SIZE_SQUARE_MODEL, 200, 8, true);
+    volatile xyShape_t* square2 = xyRenderShape(squareModel, SIZE_SQUARE_MODEL, 200, 8, true);
 
     // Render moving diamond
     // - This shape is not being translated, so no buffer is needed. The shape handler ('diamond') is stored so it may be
@@ -100,13 +97,10 @@ int main()
     volatile xyShape_t* diamond = xyRenderShape(diamondModel, SIZE_DIAMOND_MODEL, 0, 0, true);
 
     // Render scaling coin
-    // - The coin consists of 2 shapes, each of which are moved in unison. Because both models are being translated, 2 buffers
-    //   are required. The circle buffer contains a copy of the procedurally generated circle model. The sign buffer contains a
-    //   copy of the dollar sign symbol ('$') after the same translation is applied.
-    xyPoint_t coinCircleBuffer[SIZE_CIRCLE_MODEL];
-    xyPoint_t coinSignBuffer[xyShapeSize16x16Ascii['$']];
-    xyRenderShape(coinCircleBuffer, SIZE_CIRCLE_MODEL, 128 - RADIUS_CIRCLE_MODEL, 128 - RADIUS_CIRCLE_MODEL, true);
-    xyRenderShape(coinSignBuffer, xyShapeSize16x16Ascii['$'], 128 - 9, 128 - 12, true);
+    // - The coin consists of 2 shapes, each of which are transformed in unison. The circle is the procedurally generated
+    //   circle model, the sign is the dollar sign symbol ('$') from the built-in ASCII table.
+    volatile xyShape_t* coinCircle = xyRenderShape(circleModel, SIZE_CIRCLE_MODEL, 128 - RADIUS_CIRCLE_MODEL, 128 - RADIUS_CIRCLE_MODEL, true);
+    volatile xyShape_t* coinSign   = xyRenderShape(xyShape16x16Ascii['$'], xyShapeSize16x16Ascii['$'], 128 - 9, 128 - 12, true);
 
     // Animation --------------------------------------------------------------------------------------------------------------
 
@@ -116,11 +110,11 @@ int main()
     while(true)
     {
         // Update rotating square 1
-        // - Copies the translated square model into its buffer.
-        xyShapeRotate(squareModel, square1Buffer, SIZE_SQUARE_MODEL, X_CENTER_SQUARE_MODEL, Y_CENTER_SQUARE_MODEL, time);
+        // - Rotates the square about its center, the model itself is left untouched.
+        xyShapeTransform(square1, X_CENTER_SQUARE_MODEL, Y_CENTER_SQUARE_MODEL, 0, 0, XY_FIXED_ONE, XY_FIXED_ONE, XY_ANGLE(time));
 
-        // Update rotating square 1
-        xyShapeRotate(squareModel, square2Buffer, SIZE_SQUARE_MODEL, X_CENTER_SQUARE_MODEL, Y_CENTER_SQUARE_MODEL, -2.0f * time);
+        // Update rotating square 2
+        xyShapeTransform(square2, X_CENTER_SQUARE_MODEL, Y_CENTER_SQUARE_MODEL, 0, 0, XY_FIXED_ONE, XY_FIXED_ONE, XY_ANGLE(-2.0f * time));
 
         // Update moving diamond
         // - Updating the position here moves the model on-screen, as they operate on shared memory.
@@ -128,12 +122,18 @@ int main()
         diamond->positionY = roundf(sin(2.0 * time) * 12.0f + 200.0f);
 
         // Update scaling coin
-        // - Scales both models in unison. The source model of the sign comes from the built-in ASCII table.
-        xyShapeScale(circleModel, coinCircleBuffer, SIZE_CIRCLE_MODEL, RADIUS_CIRCLE_MODEL, RADIUS_CIRCLE_MODEL, cos(time), 1.0f);
-        xyShapeTranslate(xyShape16x16Ascii['$'], coinSignBuffer, xyShapeSize16x16Ascii['$'], 9, 12, 3, 4, 1.5f * cos(time), 1.5f, 0);
+        // - Scales both models in unison.
+        xyShapeTransform(coinCircle, RADIUS_CIRCLE_MODEL, RADIUS_CIRCLE_MODEL, 0, 0, XY_FIXED(cosf(time)), XY_FIXED_ONE, 0);
+        xyShapeTransform(coinSign, 9, 12, 3, 4, XY_FIXED(1.5f * cosf(time)), XY_FIXED(1.5f), 0);
+
+        // Display the updated scene
+        xyRendererCommit();
 
         // Short delay
+        // - Every motion has a period of 2*PI, wrapping keeps the time small enough to stay precise (and in the range of
+        //   XY_ANGLE).
         sleep_ms(1);
         time += 0.00314f;
+        if(time >= 2.0f * M_PI) time -= 2.0f * M_PI;
     }
 }
@@ -9,6 +9,7 @@
 //    - Defining datatypes for the X and Y signals.
 //    - Implementing the X and Y signal outputs.
 //    - Providing a method to update the X and Y signal values.
+//    - Providing an output engine to play back pre-computed streams of samples with fixed timing.
 //
 //   The main purpose of this file is to implement a standard interface that higher lever sections of the library may refer to.
 //   This file is not intended to be used directly in user applications, but that does not mean that it cannot be.
@@ -51,6 +52,59 @@ typedef struct xyPoint xyPoint_t;
 // - Only holds values from [0, 255].
 typedef uint8_t xyColor_t;
 
+// X-Y RGB Color
+// - Datatype to represent a full color (red, green, and blue channels).
+struct xyRgb
+{
+    xyColor_t red;
+    xyColor_t green;
+    xyColor_t blue;
+};
+
+// Typedef for brevity.
+typedef struct xyRgb xyRgb_t;
+
+// X-Y Sample
+// - Datatype to represent a single step of the output stream.
+// - Bits [15:0] hold the output word of the X-Y ports (see xyGetSample).
+// - Bits [30:16] hold the dwell of the sample, that is how long to wait after the output word is written. The encoding is
+//   specific to the output engine, use xyGetSample to create samples.
+// - Bit 31 is the sync flag, when set the next color of the stream is applied after the dwell has elapsed.
+typedef uint32_t xySample_t;
+
+#define XY_STREAM_TICKS_PER_US  10           // Number of stream ticks per microsecond.
+#define XY_SAMPLE_DWELL_SHIFT   16           // Bit offset of the dwell in a sample.
+#define XY_SAMPLE_DWELL_MAX     0x7FFF       // Maximum dwell of a single sample, in stream ticks.
+#define XY_SAMPLE_SYNC          0x80000000   // Sync flag of a sample.
+
+// X-Y Stream
+// - Datatype to represent a buffer of samples to be played back by the output engine.
+// - Each sample with the sync flag set consumes the next element of the color array, in order.
+// - The durations are maintained by the functions of 'xy_stream.h', for the purpose of statistics. Lit, color, and the
+//   remaining (blank) time sum to the duration.
+// - See 'xy_stream.h' for functions to populate a stream.
+struct xyStream
+{
+    xySample_t* samples;                     // Array of samples to output, in order of playback.
+    uint16_t    sampleCount;                 // Number of valid elements in the sample array.
+    uint16_t    sampleCapacity;              // Size of the sample array.
+    xyRgb_t*    colors;                      // Array of colors to apply, one per sync flag.
+    uint16_t    colorCount;                  // Number of valid elements in the color array.
+    uint16_t    colorCapacity;               // Size of the color array.
+    xyCoord_t   stepMax;                     // Longest lit move made in a single step, 0 to disable (see xyStreamMove).
+    uint32_t    stepDwellTicks;              // Dwell of a step of the maximum length, in stream ticks.
+    xyCoord_t   cursorX;                     // X position of the cursor after the last sample.
+    xyCoord_t   cursorY;                     // Y position of the cursor after the last sample.
+    bool        lit;                         // Indicates whether the beam is on after the last sample.
+    xyRgb_t     color;                       // Color of the beam after the last sample.
+    uint32_t    durationTicks;               // Time to play the whole stream, in stream ticks.
+    uint32_t    litTicks;                    // Time spent with the beam on, excluding color changes.
+    uint32_t    colorTicks;                  // Time spent holding the cursor for color changes.
+};
+
+// Typedef for brevity.
+typedef struct xyStream xyStream_t;
+
 // Functions ------------------------------------------------------------------------------------------------------------------
 
 // Setup X & Y Ports
@@ -107,6 +161,19 @@ void xyCursorMove(xyCoord_t x, xyCoord_t y);
 // - Will block for the amount of time specified in the xySetupRbgzDelay function.
 void xyCursorColor(xyColor_t red, xyColor_t green, xyColor_t blue);
 
+// Get Sample
+// - Call to get the sample that moves the cursor to the specified position and holds it there for the specified number of
+//   stream ticks.
+// - Will clamp / wrap the coordinates depending on the specified screen settings.
+// - Dwells shorter than the minimum period of the output engine are lengthened to it, dwells longer than XY_SAMPLE_DWELL_MAX
+//   are truncated.
+xySample_t xyGetSample(xyCoord_t x, xyCoord_t y, uint16_t dwellTicks);
+
+// Get Sample Duration
+// - Call to get the time the output engine takes to play the specified sample, in stream ticks.
+// - This includes the overhead of the engine, it is the dwell of the sample after lengthening (see xyGetSample).
+uint16_t xyGetSampleTicks(xySample_t sample);
+
 // Get Cursor Move Delay
 // - Call to get the number of microseconds to wait after performing a move to the specified position.
 uint16_t xyGetCursorDelayUs(xyCoord_t x, xyCoord_t y);
@@ -115,6 +182,11 @@ uint16_t xyGetCursorDelayUs(xyCoord_t x, xyCoord_t y);
 // - Call to get the number of microseconds to wait after performing a move from point 1 to point 2.
 uint16_t xyGetMoveDelayUs(xyCoord_t x1, xyCoord_t y1, xyCoord_t x2, xyCoord_t y2);
 
+// Get Color Delay
+// - Call to get the number of microseconds to wait after changing the color of the cursor.
+// - This is the value specified in the xySetupRgbzDelay function.
+uint16_t xyGetColorDelayUs();
+
 // Get Screen Width
 // - Call to get the width of the screen in pixels.
 xyCoord_t xyScreenWidth();
@@ -131,4 +203,40 @@ xyCoord_t xyCursorX();
 // - Call to get the current position of the cursor
 xyCoord_t xyCursorY();
 
+// Stream Output --------------------------------------------------------------------------------------------------------------
+
+// Start Stream Output
+// - Call to hand the X-Y ports and the RGB / Z outputs to the output engine.
+// - The engine clocks the samples of the submitted stream out at a fixed rate (see XY_STREAM_TICKS_PER_US) without the
+//   involvement of the CPU, applying the stream's colors at each sync flag.
+// - The stream is played repeatedly until a new stream is submitted.
+// - While the engine is running, xyCursorMove and xyCursorColor may not be used.
+// - The X and Y ports must lie within 16 contiguous pins.
+void xyStreamStart();
+
+// Stop Stream Output
+// - Call to stop the output engine and return the X-Y ports to the CPU.
+// - Blocks until the current frame has finished playing. The cursor is left blanked.
+void xyStreamStop();
+
+// Submit Stream
+// - Call to queue a stream for playback.
+// - The stream is picked up at the next frame boundary (end of the currently playing stream).
+// - Wait for xyStreamPending to clear before submitting another stream.
+// - The stream's memory may not be modified until it has been picked up and then replaced by another stream, and the
+//   replacement is no longer pending.
+// - The stream must contain at least one sample.
+void xyStreamSubmit(const xyStream_t* stream);
+
+// Check Pending Stream
+// - Call to check whether a submitted stream has yet to be picked up by the output engine.
+// - A picked up stream remains pending until the stream it replaced is released. The engine's FIFO may still hold the tail
+//   of the replaced stream when its DMA switches over, the colors of which are read as its syncs play out.
+bool xyStreamPending();
+
+// Get Frame Count
+// - Call to get the number of frames completed by the output engine since it was started.
+// - Safe to call from either core, the count is updated by the engine at each frame boundary.
+uint32_t xyStreamFrames();
+
 #endif // XY_HARDWARE_H
@@ -0,0 +1,121 @@
+#ifndef XY_HOST_H
+#define XY_HOST_H
+
+// X-Y Host Simulation --------------------------------------------------------------------------------------------------------
+//
+// Author: Cole Barach
+//
+// Description: Simulation controls of the host implementation of 'xy_hardware.h' (see 'src/host'). The host implementation
+//   replaces the X-Y ports and the RGB / Z outputs with a model of the display: the beam follows the same RC response the
+//   library's timing is derived from, and deposits its energy into a persistence image as it moves.
+//
+//   Time is virtual. It only advances when the application asks it to (xyHostAdvanceUs, xyHostRunFrames), or when a
+//   function that blocks on the hardware (xyCursorColor) is called. The output engine plays streams against this clock with
+//   the exact timing of the RP2040 implementation.
+//
+//   Every cursor move and color change, whether from the CPU or the output engine, may be recorded with its timestamp.
+//
+// Naming: This file reserves the 'xyHost' prefix.
+
+// Includes -------------------------------------------------------------------------------------------------------------------
+
+#include "xy_hardware.h"
+
+// Datatypes ------------------------------------------------------------------------------------------------------------------
+
+// Host Event
+// - Record of a single change to the outputs.
+struct xyHostEvent
+{
+    uint64_t  timeTicks;                 // Virtual time of the event, in stream ticks (see XY_STREAM_TICKS_PER_US).
+    bool      color;                     // Indicates whether the event is a color change (true) or cursor move (false).
+    xyCoord_t x;                         // X position of the cursor after the event.
+    xyCoord_t y;                         // Y position of the cursor after the event.
+    xyRgb_t   rgb;                       // Color of the cursor after the event.
+};
+
+// Typedef for brevity.
+typedef struct xyHostEvent xyHostEvent_t;
+
+// Host Frame Statistics
+// - Metrics of a single frame. All times are in stream ticks.
+// - Lit and blank time sum to the frame period. Travel and color time are subsets of the two, travel being the time spent
+//   moving while blanked and color being the time spent holding still for a color change to settle.
+// - Stroke brightness is the energy deposited per pixel of beam travel while lit, one value per lit move. A perfectly even
+//   image has a variance of 0.
+struct xyHostFrameStats
+{
+    uint64_t periodTicks;                // Duration of the frame.
+    uint64_t litTicks;                   // Time spent with the beam on.
+    uint64_t blankTicks;                 // Time spent with the beam off.
+    uint64_t travelTicks;                // Time spent on blanked moves.
+    uint64_t colorTicks;                 // Time spent waiting for color changes.
+    uint32_t moveCount;                  // Number of cursor moves.
+    uint32_t colorCount;                 // Number of color changes.
+    uint32_t stream;                     // Number of streams picked up when the frame began, identifies its stream.
+    double   strokeBrightnessMean;       // Mean energy per pixel of lit travel, weighted by length.
+    double   strokeBrightnessVariance;   // Variance of the energy per pixel of lit travel, weighted by length.
+};
+
+// Typedef for brevity.
+typedef struct xyHostFrameStats xyHostFrameStats_t;
+
+// Functions ------------------------------------------------------------------------------------------------------------------
+
+// Setup Persistence Image
+// - Call to allocate the persistence image, in which the beam energy is accumulated.
+// - The screen (see xySetupScreen) is scaled to fit the image.
+// - The persistence is the time constant of the phosphor's decay, in us. Use 0 to accumulate without decay.
+// - Use a width or height of 0 to disable the image, which is the default. Beam integration is by far the most expensive
+//   part of the simulation, disable it when only the metrics are of interest.
+void xyHostSetupImage(uint16_t width, uint16_t height, uint32_t persistenceUs);
+
+// Setup Event Recording
+// - Call to enable / disable recording of events. Disabled by default.
+void xyHostSetupRecording(bool enabled);
+
+// Advance Time
+// - Call to advance virtual time by the specified number of microseconds.
+// - If the output engine is running, it plays its stream for the duration. Otherwise the cursor holds still.
+void xyHostAdvanceUs(uint32_t us);
+
+// Run Frames
+// - Call to let the output engine play the specified number of whole frames.
+// - Pending streams are picked up at frame boundaries, as they would be by the hardware.
+// - Returns the elapsed virtual time, in stream ticks. Returns 0 if the engine is not running or has no stream.
+uint64_t xyHostRunFrames(uint16_t count);
+
+// End Frame
+// - Call to mark a frame boundary manually, for applications driving the cursor directly.
+// - Frame boundaries of the output engine are marked automatically.
+void xyHostEndFrame();
+
+// Get Time
+// - Call to get the current virtual time, in stream ticks.
+uint64_t xyHostTimeTicks();
+
+// Get Frame Statistics
+// - Call to get the metrics of the most recently completed frame.
+// - Returns false if no frame has been completed yet.
+bool xyHostGetFrameStats(xyHostFrameStats_t* stats);
+
+// Get Events
+// - Call to get the recorded events, in order of time.
+// - The count is written to the specified variable, the array is valid until the next call to any simulation function.
+const xyHostEvent_t* xyHostGetEvents(uint32_t* count);
+
+// Clear Events
+// - Call to discard all recorded events.
+void xyHostClearEvents();
+
+// Clear Image
+// - Call to reset the persistence image to black.
+void xyHostClearImage();
+
+// Write Image
+// - Call to write the persistence image to the specified path as a binary PGM (greyscale, 8-bit).
+// - The image is normalized so the brightest pixel is white.
+// - Returns false if the image is disabled or the file could not be written.
+bool xyHostWriteImage(const char* path);
+
+#endif // XY_HOST_H
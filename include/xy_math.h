@@ -23,4 +23,56 @@ extern int8_t cos256x256Signed[256];
 
 extern int8_t sin256x256Signed[256];
 
+// First quadrant of a sine wave in Q15, 257 entries spanning [0, PI/2] inclusive.
+extern uint16_t sinQuarter257Q15[257];
+
+// Fixed-Point ----------------------------------------------------------------------------------------------------------------
+
+// Fixed-Point Number
+// - Signed Q16.16 value, 16 integer bits and 16 fractional bits.
+typedef int32_t xyFixed_t;
+
+#define XY_FIXED_ONE    0x10000                                                       // Value of 1.0 in Q16.16
+#define XY_FIXED(value) ((xyFixed_t)((value) * XY_FIXED_ONE))                         // Converts a constant to Q16.16
+
+// Binary Angle
+// - Angle mapping [0, 2*PI) to [0, 65536), wraps around naturally.
+// - XY_ANGLE only wraps for |theta| < 32768 * 2*PI (about 205887 rad), beyond that the conversion is undefined. Keep
+//   accumulating angles reduced (modulo 2*PI), float precision degrades well before that limit.
+typedef uint16_t xyAngle_t;
+
+#define XY_ANGLE(theta) ((xyAngle_t)(int32_t)((theta) * (65536 / 6.283185307179586))) // Converts radians to a binary angle
+
+// Affine Transform
+// - 2x3 Q16.16 matrix, maps a point (x, y) to (m00 * x + m01 * y + m02, m10 * x + m11 * y + m12).
+struct xyTransform
+{
+    xyFixed_t m00, m01, m02;
+    xyFixed_t m10, m11, m12;
+};
+
+// Typedef for brevity.
+typedef struct xyTransform xyTransform_t;
+
+// Fixed-Point Sine / Cosine
+// - Call to get the sine / cosine of the specified angle, in Q16.16.
+// - Interpolates sinQuarter257Q15, the result is within 2^-15 of the exact value.
+// - Uses integer math only.
+xyFixed_t xyFixedSin(xyAngle_t theta);
+xyFixed_t xyFixedCos(xyAngle_t theta);
+
+// RC Settling ----------------------------------------------------------------------------------------------------------------
+
+// Get RC Settling Time
+// - Call to calculate the number of microseconds it takes an RC filtered output to settle within the threshold of its
+//   intended value after a step of the specified size (see 'xy_hardware.c' for the derivation).
+// - Steps no larger than the threshold take 1us.
+// - Uses floating-point math, prefer a table generated by xyRcSettlingTable in time sensitive code.
+uint16_t xyRcSettlingUs(uint32_t delta, uint16_t rcConstantUs, uint16_t rcThreshold);
+
+// Generate RC Settling Table
+// - Call to populate a lookup table of RC settling times, indexed by step size.
+// - Element N of the table is equal to xyRcSettlingUs(N, rcConstantUs, rcThreshold).
+void xyRcSettlingTable(uint16_t* table, uint16_t tableSize, uint16_t rcConstantUs, uint16_t rcThreshold);
+
 #endif // XY_MATH_H
\ No newline at end of file
@@ -0,0 +1,99 @@
+#ifndef XY_PACKED_H
+#define XY_PACKED_H
+
+// X-Y Packed Points ----------------------------------------------------------------------------------------------------------
+//
+// Author: Cole Barach
+//
+// Description: Compact, read-only encoding of point arrays, intended for pre-rendered animations stored in flash. A packed
+//   frame is decoded on the fly while the renderer compiles it (see xyRenderPacked), it is never expanded into memory.
+//
+//   Coordinates are limited to 8 bits (screens up to 256 x 256).
+//
+// Format: All multi-byte integers are little-endian. Varints are LEB128 (7 bits per byte, least significant first, high bit
+//   set on all bytes but the last), signed values are zig-zag encoded (0, -1, 1, -2, ... => 0, 1, 2, 3, ...).
+//
+//   Frame:
+//     varint   pointCount
+//     uint8    x, y                  Absolute position of the first point, omitted if the frame is empty.
+//     delta    [pointCount - 1]      Offset of each point from the previous.
+//
+//   Delta:
+//     uint8    zx << 4 | zy          Zig-zag offsets in a single byte, if both are less than 16 (offsets [-8, 7]).
+//     -or-
+//     uint8    0xFF                  Escape (would be the offset (-8, -8)), followed by...
+//     varint   zx, zy                Zig-zag offsets.
+//
+//   Animation:
+//     uint16   frameCount
+//     uint32   offsets [frameCount + 1]  Byte offset of each frame from the start of the animation, the last being the size
+//                                         of the animation.
+//     frame    [frameCount]
+//
+// Naming: This file reserves the 'xyPacked' prefix.
+
+// Includes -------------------------------------------------------------------------------------------------------------------
+
+#include "xy_hardware.h"
+
+// Datatypes ------------------------------------------------------------------------------------------------------------------
+
+// Packed Reader
+// - State of the decoding of a packed frame, see xyPackedBegin.
+struct xyPackedReader
+{
+    const uint8_t* data;                 // Next byte to decode.
+    uint16_t       remaining;            // Number of points yet to be decoded.
+    bool           started;              // Indicates whether the first (absolute) point has been decoded.
+    xyCoord_t      x;                    // X position of the last decoded point.
+    xyCoord_t      y;                    // Y position of the last decoded point.
+};
+
+// Typedef for brevity.
+typedef struct xyPackedReader xyPackedReader_t;
+
+// Decoding -------------------------------------------------------------------------------------------------------------------
+
+// Get Frame
+// - Call to get the specified frame of a packed animation.
+const uint8_t* xyPackedFrame(const uint8_t* animation, uint16_t index);
+
+// Get Frame Count
+// - Call to get the number of frames in a packed animation.
+uint16_t xyPackedFrameCount(const uint8_t* animation);
+
+// Get Point Count
+// - Call to get the number of points in a packed frame.
+uint16_t xyPackedCount(const uint8_t* frame);
+
+// Begin Decoding
+// - Call to prepare a reader for decoding the specified packed frame from its first point.
+void xyPackedBegin(xyPackedReader_t* reader, const uint8_t* frame);
+
+// Read Points
+// - Call to decode the next points of a frame, in order.
+// - Returns the number of points written to the specified array, less than the count if the end of the frame is reached.
+uint16_t xyPackedRead(xyPackedReader_t* reader, xyPoint_t* points, uint16_t count);
+
+// Encoding -------------------------------------------------------------------------------------------------------------------
+
+// Get Encoded Size
+// - Call to get the number of bytes the specified points occupy when packed as a frame.
+uint32_t xyPackedSize(const xyPoint_t* points, uint16_t count);
+
+// Encode Frame
+// - Call to pack the specified points as a frame, into the specified buffer (see xyPackedSize).
+// - Coordinates must lie within [0, 255].
+// - Returns the number of bytes written.
+uint32_t xyPackedEncode(const xyPoint_t* points, uint16_t count, uint8_t* buffer);
+
+// Get Encoded Animation Size
+// - Call to get the number of bytes the specified frames occupy when packed as an animation.
+uint32_t xyPackedAnimationSize(xyPoint_t* const* frames, const uint16_t* frameSizes, uint16_t frameCount);
+
+// Encode Animation
+// - Call to pack the specified frames as an animation, into the specified buffer (see xyPackedAnimationSize).
+// - Returns the number of bytes written.
+uint32_t xyPackedEncodeAnimation(xyPoint_t* const* frames, const uint16_t* frameSizes, uint16_t frameCount, uint8_t* buffer);
+
+#endif // XY_PACKED_H
@@ -0,0 +1,31 @@
+#ifndef XY_POINTS_H
+#define XY_POINTS_H
+
+// X-Y Points -----------------------------------------------------------------------------------------------------------------
+//
+// Author: Cole Barach
+//
+// Description: Set of kernels for bulk operations on arrays of points. These are the operations at the core of the shape
+//   functions and the renderer.
+//
+//   On the RP2040 the kernels use the SIO interpolators of the calling core, so they may be called from either core. The
+//   interpolator state is saved on entry and restored on exit, the application is free to use the interpolators itself.
+//   Elsewhere (or with XY_POINTS_PORTABLE defined) a portable C implementation is used. Both implementations produce
+//   bit-identical results, the portable one may therefore be used to test the kernels on a host (see
+//   'benchmarks/points.c').
+//
+// Naming: This file reserves the 'xyPoints' prefix.
+
+// Includes -------------------------------------------------------------------------------------------------------------------
+
+#include "xy_hardware.h"
+
+// Functions ------------------------------------------------------------------------------------------------------------------
+
+// Offset Points
+// - Call to add the specified offset to each point of the source, storing the result in the destination.
+// - Results wrap around like the equivalent C expression, '(xyCoord_t)(x + offsetX)'.
+// - Source and destination may be the same array.
+void xyPointsOffset(const volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t count, xyCoord_t offsetX, xyCoord_t offsetY);
+
+#endif // XY_POINTS_H
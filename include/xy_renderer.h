@@ -20,58 +20,175 @@
 // Includes -------------------------------------------------------------------------------------------------------------------
 
 #include "xy_hardware.h"
+#include "xy_math.h"
 
 // Datatypes ------------------------------------------------------------------------------------------------------------------
 
 // X-Y Shape
 // - Handler for a set of X-Y points to draw in series.
 // - The position and visibility parameters may be used to control the way a shape is rendered.
+// - If transformed is set, each point is mapped through the transform before the position is added. This allows a shape to
+//   be rotated, scaled, etc. without modifying (or copying) its points, see xyShapeTransform.
+// - If packed is set, the points are decoded from it rather than read from the point array, see xyRenderPacked.
+// - If breaks are set, the shape is drawn as multiple strokes. Each break is the index of a point beginning a new stroke,
+//   the move to which is blanked. Breaks must be in ascending order, a break at the first point has no effect.
 struct xyShape
 {
     volatile xyPoint_t* points;          // Array of points to render.
     uint16_t            pointCount;      // Number of elements in the point array.
+    const uint8_t*      packed;          // Packed frame to render instead of the point array, NULL if unused.
+    const uint16_t*     breaks;          // Indices of the points beginning each stroke, NULL if unused.
+    uint16_t            breakCount;      // Number of elements in the break array.
     xyCoord_t           positionX;       // X offset of the shape.
     xyCoord_t           positionY;       // Y offset of the shape.
     xyColor_t           colorRed;        // Red channel of the color to render
     xyColor_t           colorGreen;      // Green channel of the color to render
     xyColor_t           colorBlue;       // Blue channel of the color to render.
     bool                visible;         // Indicates whether to render the shape or not.
+    bool                transformed;     // Indicates whether to apply the transform or not.
+    xyTransform_t       transform;       // Affine transform applied to each point, before the position.
 };
 
 // Typedef for brevity.
 typedef struct xyShape xyShape_t;
 
+// X-Y String
+// - Handler for a string rendered as one shape per character, see xyRenderString.
+// - The characters are consecutive shapes of the render stack. The bounds are kept so the string may be updated in place,
+//   see xyStringUpdate.
 struct xyString
 {
     volatile xyShape_t* characters;        // Array of characters in the string.
     uint16_t            characterCount;    // Number of elements in the character array.
+    xyCoord_t           lowerBoundX;       // Left bound of the string's layout.
+    xyCoord_t           lowerBoundY;       // Bottom bound of the string's layout.
+    xyCoord_t           upperBoundX;       // Right bound of the string's layout.
+    xyCoord_t           upperBoundY;       // Top bound of the string's layout.
 };
 
 // Typedef for brevity.
 typedef struct xyString xyString_t;
 
+// Renderer Statistics
+// - Counters of the renderer and the output engine, since the renderer was started. Times are in microseconds.
+// - Totals cover every frame the output engine has completed. Lit, blank, and color time are disjoint, summing to the total
+//   time spent playing frames.
+// - The most expensive shape is that of the most recently compiled commit, identified by its slot in the render stack (the
+//   order the shapes were rendered in, unless slots of removed shapes were reused).
+struct xyRendererStats
+{
+    uint32_t frames;                     // Number of frames completed by the output engine.
+    uint32_t commits;                    // Number of commits compiled by the renderer.
+    uint32_t periodMinUs;                // Shortest frame period of any compiled commit.
+    uint32_t periodAvgUs;                // Mean frame period, over every completed frame.
+    uint32_t periodMaxUs;                // Longest frame period of any compiled commit.
+    uint64_t points;                     // Number of samples output.
+    uint64_t litUs;                      // Time spent with the beam on (dwelling on shapes).
+    uint64_t blankUs;                    // Time spent with the beam off (moving between shapes).
+    uint64_t colorUs;                    // Time spent waiting for color changes.
+    uint16_t shapeMaxIndex;              // Index of the most expensive shape, UINT16_MAX if nothing was rendered.
+    uint32_t shapeMaxUs;                 // Time spent on the most expensive shape per frame, including the move to it.
+};
+
+// Typedef for brevity.
+typedef struct xyRendererStats xyRendererStats_t;
+
 // Rendering ------------------------------------------------------------------------------------------------------------------
 
 // Render Shape
 // - Call to add the specified shape to the render stack.
+// - The shape takes a slot of the stack, slots of removed shapes are reused (see xyRendererRemove). The shape is rendered
+//   last.
 // - Returns a reference to the successfully created shape, returns NULL otherwise.
+// - The shape is not displayed until the next call to xyRendererCommit, the same goes for any changes made through the
+//   reference.
 volatile xyShape_t* xyRenderShape(volatile xyPoint_t* points, uint16_t pointCount, xyCoord_t positionX, xyCoord_t positionY, bool visible);
 
+// Render Packed Shape
+// - Call to add a shape whose points are decoded from the specified packed frame (see 'xy_packed.h').
+// - The frame is decoded while the renderer compiles each commit, its points are never stored in memory. The frame may
+//   therefore reside in flash.
+// - Packed shapes are always traced from first to last point (see xyRendererOptimize).
+// - To switch frames, set the shape's packed frame and point count (see xyPackedCount) and commit.
+// - Returns a reference to the successfully created shape, returns NULL otherwise.
+volatile xyShape_t* xyRenderPacked(const uint8_t* frame, xyCoord_t positionX, xyCoord_t positionY, bool visible);
+
 // Render Char
 // - Call to render a character to the screen at the given position.
+// - Characters outside of the ASCII table (128 and up) are rendered empty.
 // - Returns a reference to the successfully created shape, returns NULL otherwise.
 volatile xyShape_t* xyRenderChar(char data, xyCoord_t xPosition, xyCoord_t yPosition);
 
 // Render String
 // - Call to render a string to the screen at the given position.
+// - The characters take consecutive slots at the top of the stack, slots of removed shapes are not reused.
 // - Returns a string handler object.
 xyString_t xyRenderString(char* data, xyCoord_t lowerBoundX, xyCoord_t lowerBoundY, xyCoord_t upperBoundX, xyCoord_t upperBoundY);
 
+// Render Baked String
+// - Call to render a string as a single shape, laid out the same way as xyRenderString.
+// - The points of each character are copied into the specified point buffer, the moves between characters are blanked (see
+//   xyShape_t), their indices are written to the specified break buffer. See xyStringBakedSize for the size of each.
+// - Buffers are referenced by the shape, not copied. They must remain valid for as long as the shape is rendered.
+// - The string occupies a single slot of the render stack and is colored as a whole. Characters that do not fit in the
+//   buffers are dropped.
+// - The shape is positioned at the first character, moving it moves the whole string.
+// - Returns a reference to the successfully created shape, returns NULL otherwise.
+volatile xyShape_t* xyRenderStringBaked(char* data, xyCoord_t lowerBoundX, xyCoord_t lowerBoundY, xyCoord_t upperBoundX, xyCoord_t upperBoundY, volatile xyPoint_t* points, uint16_t pointCapacity, uint16_t* breaks, uint16_t breakCapacity);
+
+// Remove Shape
+// - Call to remove the specified shape from the render stack, its slot is freed for the next shape rendered.
+// - Constant time. The last shape of the render order takes the place of the removed one, call xyRendererOptimize again if
+//   the order matters.
+// - The reference becomes invalid, other references remain valid. Removing a character of a string invalidates the string.
+// - The shape is not removed from the screen until the next call to xyRendererCommit.
+void xyRendererRemove(volatile xyShape_t* shape);
+
 // Clear Renderer
 // - Call to empty the render stack.
 // - All existing shape handers become invalid, nothing will be rendered until one of the render functions is called again.
+// - The screen is not cleared until the next call to xyRendererCommit.
 void xyRendererClear();
 
+// Commit Renderer
+// - Call to display the current state of the render stack.
+// - Until this is called, changes to the render stack (new shapes, clearing, and modifications through shape references) are
+//   not visible to the renderer. This allows an entire scene to be built without tearing or synchronization.
+// - Each commit is compiled into a sample stream once, which the output engine replays every frame until the next commit is
+//   displayed. A static scene therefore costs no CPU time. If multiple commits are made before the renderer picks one up,
+//   only the last is displayed.
+// - Only shapes that produce output are committed, hidden or empty shapes cost no time in the frame, nor in compiling it.
+//   Hiding a shape is therefore a way to save frame time.
+// - Point arrays are referenced, not copied. Arrays of committed shapes are read only while compiling the commit, so
+//   modifications to them take effect at the next commit. Modifying an array while a commit is being compiled may tear
+//   the frame, to change a shape's points atomically, point it to a different array and commit.
+void xyRendererCommit();
+
+// Optimize Renderer
+// - Call to reorder the render stack to minimize the time spent on blanked moves between shapes.
+// - Shapes may also be traced in reverse, if doing so shortens the path.
+// - The path is found with a greedy nearest-neighbour pass followed by 2-opt refinement. The cost of each move is the RC
+//   timing (see xyGetMoveDelayUs) plus the color changes blanking it (see xyGetColorDelayUs).
+// - A shape beginning where the previous ends continues its stroke without blanking, at no cost if both share a color. Shapes
+//   of a color that connect are therefore traced as a single stroke where possible.
+// - Only the render order changes, existing shape references remain valid.
+// - Should be called after changing the scene, before committing it. Shapes that are hidden or empty at the time of the call
+//   are placed last.
+// - Packed shapes cannot be reversed, scenes containing them only receive the greedy pass.
+void xyRendererOptimize();
+
+// Set Renderer Interpolation
+// - Call to make the renderer trace lines at a constant velocity, of the maximum step per step dwell. Lit moves longer than
+//   the maximum step (on either axis) are subdivided into evenly spaced steps, each move being held in proportion to its
+//   length (see xyStreamMove). Use a maximum step of 0 to disable, which is the default.
+// - Without it, each move is held for its RC settling time, which grows with the logarithm of its length. Long lines are
+//   therefore dimmer than short ones, and brighter at their ends than in their middle.
+// - The velocity should not outpace the RC filter, else corners are rounded off. A step dwell on the order of the RC
+//   constant (see xySetupRcTiming) keeps the beam within a step of the target.
+// - Only the compiled stream grows, the shapes are not modified. Mind the sample capacity of the renderer.
+// - Takes effect at the next commit.
+void xyRendererSetInterpolation(xyCoord_t stepMax, uint16_t stepDwellUs);
+
 // Renderer -------------------------------------------------------------------------------------------------------------------
 
 // Start Renderer
@@ -84,11 +201,31 @@ void xyRendererStart();
 // - Call to stop the renderer.
 void xyRendererStop();
 
+// Get Renderer Statistics
+// - Call to get the statistics of the renderer (see xyRendererStats), since it was last started.
+// - Safe to call from core 0 at any time. The renderer is never stalled, it only updates the statistics once per commit. The
+//   frame count is exact, the totals derived from it are accurate to within a frame of the most recent commit.
+xyRendererStats_t xyRendererGetStats();
+
 // Strings --------------------------------------------------------------------------------------------------------------------
 
 // Update String
+// - Call to change the text of a rendered string, in place.
+// - The new text is laid out within the same bounds, each character is compared against the shape in its slot and only
+//   rewritten if it differs. Characters whose glyph and position are unchanged are not modified, so text of the same length
+//   and line breaks (counters, clocks, etc.) only touches the digits that changed.
+// - Slots of the string are reused. Characters past the end of the new text are emptied, their slots remain part of the
+//   string. If the new text is longer, the string is only extended while it is at the top of the render stack, otherwise
+//   the excess characters are dropped.
+// - The render order is left untouched, the rest of the scene is unaffected. Like any modification through a shape
+//   reference, takes effect at the next commit.
 void xyStringUpdate(xyString_t* string, char* data);
 
+// Get Baked String Size
+// - Call to get the size of the point and break buffers needed to bake the specified string (see xyRenderStringBaked).
+// - Sizes cover every character of the string, including those the layout may drop.
+void xyStringBakedSize(char* data, uint16_t* pointCount, uint16_t* breakCount);
+
 // Shapes ---------------------------------------------------------------------------------------------------------------------
 
 // Copy Shape
@@ -107,13 +244,30 @@ void xyShapeAppend(volatile xyPoint_t* source, volatile xyPoint_t* destination,
 // - Offsets the shape by offsetX and offsetY.
 // - Scales the shape by scalarX and scalarY.
 // - Rotates the shape by the angle theta.
+// - The floating-point math is done once per call, the points themselves are transformed in fixed-point. The same accuracy
+//   and range limits as xyShapeTranslateFixed apply.
 void xyShapeTranslate(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, xyCoord_t offsetX, xyCoord_t offsetY, float scalarX, float scalarY, float theta);
 
+// Translate Shape (Fixed-Point)
+// - Integer-only equivalent of xyShapeTranslate, see 'xy_math.h' for the fixed-point datatypes.
+// - Scalars are Q16.16, theta is a binary angle.
+// - Each point is within 1 unit of the exact result, rounded to the nearest coordinate, for points within 4096 units of the
+//   origin (scaled). For most points the result is exact.
+// - Range: (|x| + |y|) * max(|scalarX|, |scalarY|) must be less than 32768 for every point, where x and y are relative to the
+//   origin after the offset is applied.
+void xyShapeTranslateFixed(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, xyCoord_t offsetX, xyCoord_t offsetY, xyFixed_t scalarX, xyFixed_t scalarY, xyAngle_t theta);
+
 // Rotate Shape
 // - Call to rotate the points about the specified pivot by a specified floating-point angle.
 // - Source and destination may be the same array, in which the original data of the source is lost.
+// - The floating-point math is done once per call, see xyShapeRotateFixed for accuracy and range.
 void xyShapeRotate(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, float theta);
 
+// Rotate Shape (Fixed-Point)
+// - Integer-only equivalent of xyShapeRotate, theta is a binary angle (see 'xy_math.h').
+// - Accuracy and range are the same as xyShapeTranslateFixed with unit scalars.
+void xyShapeRotateFixed(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, xyAngle_t theta);
+
 // Rotate Shape (Integer)
 // - Call to rotate the points about the specified pivot by a specified angle.
 // - Theta is an 8-bit unsigned integer, mapping [0, 2*PI) to [0, 256).
@@ -124,8 +278,32 @@ void xyShapeRotateInt(volatile xyPoint_t* source, volatile xyPoint_t* destinatio
 // - Call to scale a shape by the floating point x and y scalars.
 // - The distance to the origin of each point is multiplied by xScalar and yScalar.
 // - Source and destination may be the same array, in which the original data of the source is lost.
+// - The scalars are converted to fixed-point once per call, see xyShapeScaleFixed for accuracy and range.
 void xyShapeScale(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, float scalarX, float scalarY);
 
+// Scale Shape (Fixed-Point)
+// - Integer-only equivalent of xyShapeScale, scalars are Q16.16 (see 'xy_math.h').
+// - Results are the exact product, rounded to the nearest coordinate.
+// - Range: |x| * |scalarX| and |y| * |scalarY| must be less than 32768, where x and y are relative to the origin.
+void xyShapeScaleFixed(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, xyFixed_t scalarX, xyFixed_t scalarY);
+
+// Transform Shape
+// - Call to set the transform of a shape, the points themselves are not modified.
+// - The transform is the same as xyShapeTranslateFixed: offset, scale, then rotation about the origin. The same accuracy and
+//   range limits apply.
+// - Like any modification through a shape reference, takes effect at the next commit.
+// - Clear the shape's transformed flag to remove the transform.
+void xyShapeTransform(volatile xyShape_t* shape, xyCoord_t originX, xyCoord_t originY, xyCoord_t offsetX, xyCoord_t offsetY, xyFixed_t scalarX, xyFixed_t scalarY, xyAngle_t theta);
+
+// Get Shape Point
+// - Call to get the on-screen position of a point of a shape, with its transform and position applied.
+// - Packed shapes are decoded up to the point, this is linear in the index.
+xyPoint_t xyShapeGetPoint(volatile xyShape_t* shape, uint16_t index);
+
+// Map Shape Point
+// - Call to get the on-screen position of the specified point of a shape's model, with its transform and position applied.
+xyPoint_t xyShapeMapPoint(volatile xyShape_t* shape, xyPoint_t point);
+
 // Multiply Shape
 // - Call to scale a shape up about the specified origin.
 // - The distance to the origin of each point is multiplied by xScale and yScale.
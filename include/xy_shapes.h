@@ -10,7 +10,6 @@
 // To do:
 // - ASCII table needs finished.
 // - Configurable font sizes would be nice, maybe just add some options.
-// - Characters need updated to clean double tracing and weird end-points.
 
 // Includes -------------------------------------------------------------------------------------------------------------------
 
@@ -36,10 +35,22 @@ extern struct xyPoint xyShapePoint[XY_SHAPE_SIZE_POINT];
 // - Index correlates to the integer value of said symbol, ex. index 0x30 => '0'
 // - Each element is a pointer to the base of the point array of the symbol.
 // - The size of the symbol's point array is stored in the 'xyShapeSize16x16Ascii' array.
+// - Symbols made of multiple strokes are joined by blanked moves, see the 'xyShapeBreaks16x16Ascii' array.
+// - The tables are traced by the glyph optimizer, after editing a symbol run it to regenerate them (see 'tools/readme.md').
 extern struct xyPoint* xyShape16x16Ascii[128];
 
 // 16x16 ASCII Character Symbol Sizes Array
 // - Parallel array to the 'xyShape16x16Ascii' array, see said array's description for more info.
 extern uint16_t xyShapeSize16x16Ascii[128];
 
+// 16x16 ASCII Character Symbol Breaks Array
+// - Parallel array to the 'xyShape16x16Ascii' array, each element is the break array of the symbol (see 'xyShape_t'), NULL
+//   for symbols of a single stroke.
+// - The size of the symbol's break array is stored in the 'xyShapeBreakCount16x16Ascii' array.
+extern const uint16_t* xyShapeBreaks16x16Ascii[128];
+
+// 16x16 ASCII Character Symbol Break Counts Array
+// - Parallel array to the 'xyShapeBreaks16x16Ascii' array.
+extern uint16_t xyShapeBreakCount16x16Ascii[128];
+
 #endif // XY_SHAPES_H
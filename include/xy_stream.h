@@ -0,0 +1,77 @@
+#ifndef XY_STREAM_H
+#define XY_STREAM_H
+
+// X-Y Stream -----------------------------------------------------------------------------------------------------------------
+//
+// Author: Cole Barach
+//
+// Description: Set of functions for generating sample streams, the input of the output engine (see 'xy_hardware.h'). A
+//   stream is a flat buffer of output words, each with a dwell time, and the colors to apply between them. Generating a
+//   stream is where all of the timing of a frame is decided, playing it back requires no further computation.
+//
+//   None of these functions touch the hardware directly, the only hardware dependencies are the xyGetSample,
+//   xyGetMoveDelayUs, and xyGetColorDelayUs functions. Streams may therefore be generated and inspected on any platform
+//   implementing those.
+//
+// Naming: This file reserves the 'xyStream' prefix.
+
+// Includes -------------------------------------------------------------------------------------------------------------------
+
+#include "xy_hardware.h"
+#include "xy_renderer.h"
+
+// Functions ------------------------------------------------------------------------------------------------------------------
+
+// Begin Stream
+// - Call to empty a stream before populating it.
+// - The cursor position is where the cursor will be when playback of the stream begins, for streams played in a loop this
+//   is typically where the previous stream ended.
+void xyStreamBegin(xyStream_t* stream, xyCoord_t cursorX, xyCoord_t cursorY);
+
+// Move Stream Cursor
+// - Call to append a move to the specified position.
+// - The dwell of the move is the RC settling time of the move (see xyGetMoveDelayUs).
+// - If the beam is on and the stream has a maximum step, the move is instead made at a constant velocity of one maximum step
+//   per step dwell. Moves longer than the maximum step (on either axis) are subdivided into evenly spaced steps, each held
+//   for its share of the dwell. Lines of any length are therefore drawn at a uniform brightness.
+// - Returns false if the stream is full, in which case the stream is not modified.
+bool xyStreamMove(xyStream_t* stream, xyCoord_t x, xyCoord_t y);
+
+// Color Stream Cursor
+// - Call to append a color change.
+// - The color is applied after the last sample in the stream, after which the cursor is held for the duration of the color
+//   delay (see xyGetColorDelayUs).
+// - Returns false if the stream is full, in which case the stream is not modified.
+bool xyStreamColor(xyStream_t* stream, xyColor_t red, xyColor_t green, xyColor_t blue);
+
+// Move Stream Cursor with Color
+// - Call to append a move to the specified position, changing color on the way, such that the color has settled once the
+//   cursor arrives.
+// - The color is applied one color delay (see xyGetColorDelayUs) before the end of the move, the change overlapping the
+//   move. If the move is shorter than the color delay, the color is applied as the move begins and the cursor is held at
+//   the position for the remainder of the delay.
+// - Returns false if the stream is full, in which case the stream is not modified.
+bool xyStreamMoveColor(xyStream_t* stream, xyCoord_t x, xyCoord_t y, xyColor_t red, xyColor_t green, xyColor_t blue);
+
+// Append Shape to Stream
+// - Call to append the specified shape to the stream.
+// - The cursor is moved to the first point blanked, after which the beam is turned on and the remaining points are traced.
+// - The beam is left on at the last point. If the next shape begins there, its stroke continues from it without blanking,
+//   the color only being written if the shapes differ in color. Otherwise the beam is turned off before moving away. Use
+//   xyStreamEnd once all shapes are appended.
+// - The beam is also turned off for the move into each break of the shape (the move out of it if reversed).
+// - The beam is turned on during the move to the first point of each stroke (see xyStreamMoveColor), only the part of the
+//   color delay that is longer than the move is waited for. The beam is turned off before moving away from a stroke, that
+//   delay is always waited for.
+// - Use reverse to trace the points from last to first.
+// - Invisible and empty shapes are ignored.
+// - Returns false if the stream does not have space for the whole shape, in which case the stream is not modified.
+bool xyStreamShape(xyStream_t* stream, volatile xyShape_t* shape, bool reverse);
+
+// End Stream
+// - Call to turn off the beam left on by the last shape of the stream, if any.
+// - Appending a shape keeps space for this, so this cannot fail following a successful xyStreamShape call.
+// - Returns false if the stream is full, in which case the stream is not modified.
+bool xyStreamEnd(xyStream_t* stream);
+
+#endif // XY_STREAM_H
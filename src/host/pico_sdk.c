@@ -0,0 +1,82 @@
+// Pico SDK (Host) ------------------------------------------------------------------------------------------------------------
+//
+// Author: Cole Barach
+//
+// Description: Host implementations of the few Pico SDK functions used by the platform-independent sources of the library,
+//   allowing the renderer to run unmodified on the host. See the headers in the 'sdk' directory.
+
+// Libraries ------------------------------------------------------------------------------------------------------------------
+
+// Pico SDK (Host)
+#include <pico/multicore.h>
+#include <hardware/sync.h>
+
+// POSIX Libraries
+#include <pthread.h>
+#include <sched.h>
+
+// Constants ------------------------------------------------------------------------------------------------------------------
+
+#define SPIN_LOCK_COUNT 32               // Number of hardware spin locks of the RP2040.
+
+// Global Memory --------------------------------------------------------------------------------------------------------------
+
+spin_lock_t     spinLocks[SPIN_LOCK_COUNT] = { ATOMIC_FLAG_INIT };
+atomic_uint     spinLocksClaimed           = 0;
+
+// Functions ------------------------------------------------------------------------------------------------------------------
+
+void* core1Entrypoint(void* entry)
+{
+    ((void (*)(void))entry)();
+    return NULL;
+}
+
+void multicore_launch_core1(void (*entry)(void))
+{
+    pthread_t thread;
+    pthread_create(&thread, NULL, core1Entrypoint, (void*)entry);
+    pthread_detach(thread);
+}
+
+int spin_lock_claim_unused(bool required)
+{
+    for(unsigned int index = 0; index < SPIN_LOCK_COUNT; ++index)
+    {
+        unsigned int mask = 1u << index;
+        if((atomic_fetch_or(&spinLocksClaimed, mask) & mask) == 0) return index;
+    }
+
+    (void)required;
+    return -1;
+}
+
+spin_lock_t* spin_lock_init(unsigned int lockNumber)
+{
+    atomic_flag_clear(&spinLocks[lockNumber]);
+    return &spinLocks[lockNumber];
+}
+
+void spin_lock_unsafe_blocking(spin_lock_t* lock)
+{
+    while(atomic_flag_test_and_set_explicit(lock, memory_order_acquire)) sched_yield();
+}
+
+void spin_unlock_unsafe(spin_lock_t* lock)
+{
+    atomic_flag_clear_explicit(lock, memory_order_release);
+}
+
+void __sev()
+{
+}
+
+void __wfe()
+{
+    sched_yield();
+}
+
+void __dmb()
+{
+    atomic_thread_fence(memory_order_seq_cst);
+}
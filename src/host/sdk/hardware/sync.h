@@ -0,0 +1,39 @@
+#ifndef HARDWARE_SYNC_H
+#define HARDWARE_SYNC_H
+
+// Hardware Synchronization (Host) --------------------------------------------------------------------------------------------
+//
+// Author: Cole Barach
+//
+// Description: Host stand-in for the Pico SDK header of the same name. Spin locks are atomic flags, events are approximated
+//   by yielding the thread, barriers are atomic fences (see 'pico_sdk.c').
+
+// Includes -------------------------------------------------------------------------------------------------------------------
+
+#include <stdatomic.h>
+#include <stdbool.h>
+
+// Datatypes ------------------------------------------------------------------------------------------------------------------
+
+typedef atomic_flag spin_lock_t;
+
+// Functions ------------------------------------------------------------------------------------------------------------------
+
+// Spin Locks
+// - Same semantics as the SDK, 32 locks are available.
+int spin_lock_claim_unused(bool required);
+spin_lock_t* spin_lock_init(unsigned int lockNumber);
+void spin_lock_unsafe_blocking(spin_lock_t* lock);
+void spin_unlock_unsafe(spin_lock_t* lock);
+
+// Events
+// - Send event is a no-op, wait for event yields the thread. Anything waiting on an event re-checks its condition after
+//   waking, so this only costs host CPU time.
+void __sev();
+void __wfe();
+
+// Memory Barrier
+// - Full fence, same as the SDK.
+void __dmb();
+
+#endif // HARDWARE_SYNC_H
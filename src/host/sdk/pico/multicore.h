@@ -0,0 +1,16 @@
+#ifndef PICO_MULTICORE_H
+#define PICO_MULTICORE_H
+
+// Pico Multicore (Host) ------------------------------------------------------------------------------------------------------
+//
+// Author: Cole Barach
+//
+// Description: Host stand-in for the Pico SDK header of the same name. Core 1 is emulated by a thread (see 'pico_sdk.c').
+
+// Functions ------------------------------------------------------------------------------------------------------------------
+
+// Launch Core 1
+// - Call to run the specified function on a new thread, in place of core 1.
+void multicore_launch_core1(void (*entry)(void));
+
+#endif // PICO_MULTICORE_H
@@ -0,0 +1,17 @@
+#ifndef PICO_STDLIB_H
+#define PICO_STDLIB_H
+
+// Pico Standard Library (Host) -----------------------------------------------------------------------------------------------
+//
+// Author: Cole Barach
+//
+// Description: Host stand-in for the Pico SDK header of the same name. Only what the platform-independent sources of the
+//   library use is provided (see 'pico_sdk.c').
+
+// Includes -------------------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#endif // PICO_STDLIB_H
@@ -0,0 +1,802 @@
+// Header
+#include "xy_hardware.h"
+#include "xy_host.h"
+
+// Theory ---------------------------------------------------------------------------------------------------------------------
+//
+// This is the host (x86 / Linux) implementation of 'xy_hardware.h'. Rather than driving outputs, it simulates the display.
+// See 'src/pico/xy_hardware.c' for the derivation of the RC timing, which this implementation shares.
+//
+// The DAC outputs (the target position) change instantly on a cursor move. The beam position follows each axis of the
+// target independently through the RC filter:
+//
+//   X_o(t + dt) = X_i + (X_o(t) - X_i) * e^(-dt / RC)
+//
+// The beam is integrated one stream tick at a time while the persistence image is enabled, depositing its intensity (the
+// luma of the current color, see the Z output of the RP2040 implementation) into the image with a bilinear splat. When the
+// image is disabled, the closed form is used to skip to the end of each interval. Phosphor decay is applied to the whole
+// image at frame boundaries, rather than continuously.
+//
+// The output engine plays streams with the same timing as the RP2040 engine, each sample holds for its dwell plus the fixed
+// overhead of the PIO program. Colors are applied at the end of the dwell of each sample carrying a sync flag.
+
+// Libraries ------------------------------------------------------------------------------------------------------------------
+
+// X-Y Library
+#include "xy_math.h"
+
+// C Standard Libraries
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Constants ------------------------------------------------------------------------------------------------------------------
+
+#define RC_DELAY_TABLE_SIZE  1024        // Number of step sizes to tabulate the RC delay of, same as the RP2040.
+#define SAMPLE_OVERHEAD      5           // Fixed overhead of each sample of the RP2040 engine, in ticks.
+#define FIFO_DEPTH           8           // Depth of the (joined) TX FIFO of the RP2040 engine, in samples.
+
+// Datatypes ------------------------------------------------------------------------------------------------------------------
+
+// FIFO Entry
+// - Sample handed to the engine by the DMA, along with the frame it belongs to.
+struct fifoEntry
+{
+    xySample_t sample;                   // Sample to play.
+    uint32_t   stream;                   // Number of streams picked up when the DMA began the sample's frame.
+    bool       last;                     // Indicates the sample is the last of its frame.
+};
+
+// Typedef for brevity.
+typedef struct fifoEntry fifoEntry_t;
+
+// Global Data ----------------------------------------------------------------------------------------------------------------
+
+static uint16_t portXOffset    = 0;      // Starting bit of the X port in the output word (pre-shift).
+static uint32_t portXMask      = 0;      // Bitmask of the X port.
+static uint16_t portYOffset    = 0;      // Starting bit of the Y port in the output word (pre-shift).
+static uint32_t portYMask      = 0;      // Bitmask of the Y port.
+static uint16_t streamPinBase  = 0;      // Shift of the output word (lowest bit of the X & Y ports).
+
+static xyCoord_t screenWidth   = 0;      // Width of the screen in pixels.
+static xyCoord_t screenHeight  = 0;      // Height of the screen in pixels.
+static bool      screenWrap    = false;  // Indicates whether to clamp or wrap coordinates within the screen boundaries.
+
+static xyCoord_t cursorX       = 0;      // Current x position of the cursor (DAC output).
+static xyCoord_t cursorY       = 0;      // Current y position of the cursor (DAC output).
+static xyRgb_t   cursorRgb     = {0};    // Current color of the cursor.
+
+static uint16_t rcConstantUs   = 1;      // RC time constant of the output low-pass filter, in us.
+static uint16_t rcThreshold    = 1;      // Minimum acceptable error in the cursor position due to RC filtering.
+static uint16_t rcDelayTable[RC_DELAY_TABLE_SIZE]; // Delay in us after a move, indexed by the larger of the X & Y steps.
+
+static uint16_t rgbzDelay      = 0;      // Time to wait after a color change, in us.
+
+// Simulation State -----------------------------------------------------------------------------------------------------------
+
+static uint64_t hostTime       = 0;      // Virtual time, in ticks.
+static double   beamX          = 0;      // Actual x position of the beam (RC filtered).
+static double   beamY          = 0;      // Actual y position of the beam (RC filtered).
+static double   beamIntensity  = 0;      // Intensity of the beam, [0, 1].
+static bool     beamTravel     = false;  // Indicates the current interval is a move (as opposed to a hold).
+static bool     beamColorHold  = false;  // Indicates the current interval is waiting on a color change.
+static double   strokeEnergy   = 0;      // Energy deposited since the last event.
+static double   strokeLength   = 0;      // Length of the move of the last event, in pixels.
+
+static float*   image          = NULL;   // Persistence image, row-major, top row first.
+static uint16_t imageWidth     = 0;      // Width of the persistence image.
+static uint16_t imageHeight    = 0;      // Height of the persistence image.
+static uint32_t imagePersistenceUs = 0;  // Time constant of the phosphor decay, 0 for none.
+static uint64_t imageDecayTime = 0;      // Time the decay was last applied at.
+
+static bool           recording     = false; // Indicates whether to record events.
+static xyHostEvent_t* events        = NULL;  // Recorded events.
+static uint32_t       eventCount    = 0;     // Number of recorded events.
+static uint32_t       eventCapacity = 0;     // Size of the event array.
+
+static xyHostFrameStats_t frameCurrent;      // Metrics of the frame in progress.
+static xyHostFrameStats_t frameLast;         // Metrics of the last completed frame.
+static bool     frameValid     = false;      // Indicates whether frameLast is valid.
+static double   strokeWeight   = 0;          // Sum of the stroke lengths of the current frame.
+static double   strokeSum      = 0;          // Length-weighted sum of the stroke brightnesses of the current frame.
+static double   strokeSumSquares = 0;        // Length-weighted sum of the squared stroke brightnesses of the current frame.
+
+// The renderer submits streams from its own thread, the engine state it shares is volatile.
+// - Same as the RP2040 engine, the DMA feeds samples into the FIFO ahead of the PIO. It switches to the pending stream as it
+//   finishes feeding a frame, while the FIFO still holds the tail of that frame. Colors are tracked the same way.
+static volatile bool              streamActive        = false; // Indicates whether the output engine is running.
+static const xyStream_t* volatile streamPlaying       = NULL;  // Stream being fed to the FIFO.
+static const xyStream_t* volatile streamPending       = NULL;  // Stream to play at the next frame boundary.
+static const xyStream_t* volatile streamColor         = NULL;  // Stream whose colors are currently being applied.
+static uint16_t                   streamColorIndex    = 0;     // Index of the next color to apply.
+static uint16_t                   streamColorFrames   = 0;     // Frames of the color stream fed to the FIFO, colors pending.
+static uint16_t                   streamPlayingFrames = 0;     // Same, of the playing stream while not the color stream.
+static uint32_t                   streamPickups       = 0;     // Number of streams picked up since the engine was started.
+static bool                       streamFeeding       = false; // Indicates the DMA is feeding a frame.
+static uint16_t                   streamSampleIndex   = 0;     // Index of the next sample to feed.
+static uint32_t                   streamRemaining     = 0;     // Ticks remaining of the current sample, 0 if it has yet to start.
+static volatile uint32_t          streamFrames        = 0;     // Number of frames fed since the engine was started.
+
+static fifoEntry_t fifo[FIFO_DEPTH];         // Samples fed by the DMA, yet to be pulled by the PIO.
+static uint16_t    fifoHead       = 0;       // Index of the oldest entry of the FIFO.
+static uint16_t    fifoCount      = 0;       // Number of entries in the FIFO.
+static fifoEntry_t sampleCurrent;            // Sample being played.
+static fifoEntry_t sampleNext;               // Sample pulled from the FIFO, to be played next.
+static bool        sampleLoaded   = false;   // Indicates the next sample has been pulled.
+
+// Function Prototypes --------------------------------------------------------------------------------------------------------
+
+// Clamp Cursor
+// - Call to clamp / wrap the specified coordinates depending on the screen settings.
+void cursorClamp(xyCoord_t* x, xyCoord_t* y);
+
+// Beam Move / Color
+// - Call to change the DAC / color outputs, at the current virtual time.
+void beamMove(xyCoord_t x, xyCoord_t y);
+void beamColor(xyColor_t red, xyColor_t green, xyColor_t blue);
+
+// Beam Integrate
+// - Call to advance virtual time by the specified number of ticks, with the outputs held constant.
+void beamIntegrate(uint64_t ticks);
+
+// Stroke End
+// - Call to close the interval since the previous event, accumulating its stroke brightness.
+void strokeEnd();
+
+// Frame End
+// - Call to complete the current frame's metrics and begin the next.
+void frameEnd();
+
+// Event Record
+// - Call to record an event with the current state of the outputs.
+void eventRecord(bool color);
+
+// Image Splat
+// - Call to deposit energy at the specified screen position.
+void imageSplat(double x, double y, double energy);
+
+// Image Decay
+// - Call to apply the phosphor decay up to the current time.
+void imageDecay();
+
+// Engine Run
+// - Call to play the output engine until either the specified time is reached or the specified number of frames has been
+//   completed.
+// - Returns the number of frames completed.
+uint16_t engineRun(uint64_t untilTicks, uint16_t frameLimit);
+
+// Engine Frame
+// - Call to start feeding the next frame, switching to the pending stream if there is one (the DMA handler of the RP2040).
+void engineFrame();
+
+// Engine Feed
+// - Call to feed samples of the playing stream until the FIFO is full or the frame has been fed.
+void engineFeed();
+
+// Engine Pull
+// - Call to pull the next sample from the FIFO, the DMA refilling it. Returns false if the FIFO is empty.
+bool enginePull(fifoEntry_t* entry);
+
+// Engine Sync
+// - Call to apply the next color (the sync handler of the RP2040).
+void engineSync();
+
+// Engine Color Next
+// - Call to move on to the colors of the playing stream, releasing the previous stream.
+void engineColorNext();
+
+// Functions ------------------------------------------------------------------------------------------------------------------
+
+void xySetupXy(uint16_t portXOffset_, uint16_t portXSize, uint16_t portYOffset_, uint16_t portYSize)
+{
+    // Store port mapping, only used to pack samples the same way the RP2040 does
+    portXOffset = portXOffset_;
+    portYOffset = portYOffset_;
+    portXMask   = ((1u << portXSize) - 1) << portXOffset;
+    portYMask   = ((1u << portYSize) - 1) << portYOffset;
+
+    // Set default screen size
+    screenWidth  = 1 << portXSize;
+    screenHeight = 1 << portYSize;
+
+    // Output word of the stream begins at the lowest pin
+    streamPinBase = portXOffset < portYOffset ? portXOffset : portYOffset;
+
+    // Tabulate default RC timing
+    xyRcSettlingTable(rcDelayTable, RC_DELAY_TABLE_SIZE, rcConstantUs, rcThreshold);
+}
+
+void xySetupZ(int16_t pinZ)
+{
+    // No outputs to configure, the beam intensity is always the luma of the color
+    (void)pinZ;
+}
+
+void xySetupRgb(int16_t pinRed, int16_t pinGreen, int16_t pinBlue)
+{
+    // No outputs to configure, the beam intensity is always the luma of the color
+    (void)pinRed;
+    (void)pinGreen;
+    (void)pinBlue;
+}
+
+void xySetupRgbzDelay(uint16_t delayUs)
+{
+    rgbzDelay = delayUs;
+}
+
+void xySetupRcTiming(uint16_t rcConstantUs_, uint16_t rcPixelThreshold_)
+{
+    rcConstantUs = rcConstantUs_;
+    rcThreshold  = rcPixelThreshold_;
+
+    // Tabulate delays
+    xyRcSettlingTable(rcDelayTable, RC_DELAY_TABLE_SIZE, rcConstantUs, rcThreshold);
+}
+
+void xySetupScreen(xyCoord_t width, xyCoord_t height, bool wrap)
+{
+    screenWidth  = width;
+    screenHeight = height;
+    screenWrap   = wrap;
+}
+
+void xyCursorMove(xyCoord_t x, xyCoord_t y)
+{
+    cursorClamp(&x, &y);
+    beamMove(x, y);
+}
+
+void xyCursorColor(xyColor_t red, xyColor_t green, xyColor_t blue)
+{
+    beamColor(red, green, blue);
+
+    // Wait for output to be valid
+    beamIntegrate((uint64_t)rgbzDelay * XY_STREAM_TICKS_PER_US);
+}
+
+xySample_t xyGetSample(xyCoord_t x, xyCoord_t y, uint16_t dwellTicks)
+{
+    cursorClamp(&x, &y);
+
+    uint32_t outputValue = (((uint32_t)x << portXOffset) & portXMask) | (((uint32_t)y << portYOffset) & portYMask);
+
+    // Same encoding as the RP2040, each sample has a fixed overhead
+    if(dwellTicks > XY_SAMPLE_DWELL_MAX) dwellTicks = XY_SAMPLE_DWELL_MAX;
+    uint32_t dwellCount = dwellTicks > SAMPLE_OVERHEAD ? dwellTicks - SAMPLE_OVERHEAD : 0;
+
+    return ((outputValue >> streamPinBase) & 0xFFFF) | (dwellCount << XY_SAMPLE_DWELL_SHIFT);
+}
+
+uint16_t xyGetSampleTicks(xySample_t sample)
+{
+    return ((sample & ~XY_SAMPLE_SYNC) >> XY_SAMPLE_DWELL_SHIFT) + SAMPLE_OVERHEAD;
+}
+
+uint16_t xyGetCursorDelayUs(xyCoord_t x, xyCoord_t y)
+{
+    return xyGetMoveDelayUs(cursorX, cursorY, x, y);
+}
+
+uint16_t xyGetMoveDelayUs(xyCoord_t x1, xyCoord_t y1, xyCoord_t x2, xyCoord_t y2)
+{
+    xyCoordLong_t deltaX = (xyCoordLong_t)x2 - x1;
+    xyCoordLong_t deltaY = (xyCoordLong_t)y2 - y1;
+
+    if(deltaX < 0) deltaX = -deltaX;
+    if(deltaY < 0) deltaY = -deltaY;
+    xyCoordLong_t deltaMax = deltaX > deltaY ? deltaX : deltaY;
+
+    if(deltaMax >= RC_DELAY_TABLE_SIZE) return xyRcSettlingUs(deltaMax, rcConstantUs, rcThreshold);
+    return rcDelayTable[deltaMax];
+}
+
+uint16_t xyGetColorDelayUs()
+{
+    return rgbzDelay;
+}
+
+xyCoord_t xyScreenWidth()
+{
+    return screenWidth;
+}
+
+xyCoord_t xyScreenHeight()
+{
+    return screenHeight;
+}
+
+xyCoord_t xyCursorX()
+{
+    return cursorX;
+}
+
+xyCoord_t xyCursorY()
+{
+    return cursorY;
+}
+
+void xyStreamStart()
+{
+    if(streamActive) return;
+
+    beamColor(0, 0, 0);
+
+    streamActive        = true;
+    streamPlaying       = NULL;
+    streamColor         = NULL;
+    streamColorIndex    = 0;
+    streamColorFrames   = 0;
+    streamPlayingFrames = 0;
+    streamPickups       = 0;
+    streamFeeding       = false;
+    streamRemaining     = 0;
+    streamFrames        = 0;
+    fifoCount           = 0;
+    sampleLoaded        = false;
+
+    // Start playback if a stream has already been submitted
+    if(streamPending != NULL) engineFrame();
+}
+
+void xyStreamStop()
+{
+    if(!streamActive) return;
+
+    // Let the current frame finish, the DMA stops feeding once it is done with it
+    streamActive = false;
+    engineRun(UINT64_MAX, UINT16_MAX);
+
+    streamPlaying = NULL;
+    streamColor   = NULL;
+
+    // Blank cursor
+    beamColor(0, 0, 0);
+}
+
+void xyStreamSubmit(const xyStream_t* stream)
+{
+    streamPending = stream;
+
+    // Start playback if the engine is waiting on its first stream
+    if(streamActive && streamPlaying == NULL) engineFrame();
+}
+
+bool xyStreamPending()
+{
+    // The replaced stream is in use until its last color has been applied
+    return streamPending != NULL || streamColor != streamPlaying;
+}
+
+uint32_t xyStreamFrames()
+{
+    return streamFrames;
+}
+
+// Simulation Functions -------------------------------------------------------------------------------------------------------
+
+void xyHostSetupImage(uint16_t width, uint16_t height, uint32_t persistenceUs)
+{
+    free(image);
+    image       = NULL;
+    imageWidth  = 0;
+    imageHeight = 0;
+
+    imagePersistenceUs = persistenceUs;
+    imageDecayTime     = hostTime;
+
+    if(width == 0 || height == 0) return;
+
+    image = calloc((size_t)width * height, sizeof(float));
+    if(image == NULL) return;
+
+    imageWidth  = width;
+    imageHeight = height;
+}
+
+void xyHostSetupRecording(bool enabled)
+{
+    recording = enabled;
+}
+
+void xyHostAdvanceUs(uint32_t us)
+{
+    engineRun(hostTime + (uint64_t)us * XY_STREAM_TICKS_PER_US, UINT16_MAX);
+}
+
+uint64_t xyHostRunFrames(uint16_t count)
+{
+    if(!streamActive || streamPlaying == NULL) return 0;
+
+    uint64_t start = hostTime;
+    engineRun(UINT64_MAX, count);
+    return hostTime - start;
+}
+
+void xyHostEndFrame()
+{
+    frameEnd();
+}
+
+uint64_t xyHostTimeTicks()
+{
+    return hostTime;
+}
+
+bool xyHostGetFrameStats(xyHostFrameStats_t* stats)
+{
+    if(!frameValid) return false;
+
+    *stats = frameLast;
+    return true;
+}
+
+const xyHostEvent_t* xyHostGetEvents(uint32_t* count)
+{
+    *count = eventCount;
+    return events;
+}
+
+void xyHostClearEvents()
+{
+    eventCount = 0;
+}
+
+void xyHostClearImage()
+{
+    if(image != NULL) memset(image, 0, (size_t)imageWidth * imageHeight * sizeof(float));
+    imageDecayTime = hostTime;
+}
+
+bool xyHostWriteImage(const char* path)
+{
+    if(image == NULL) return false;
+
+    imageDecay();
+
+    FILE* file = fopen(path, "wb");
+    if(file == NULL) return false;
+
+    // Normalize to the brightest pixel
+    float maximum = 0;
+    for(size_t index = 0; index < (size_t)imageWidth * imageHeight; ++index)
+    {
+        if(image[index] > maximum) maximum = image[index];
+    }
+    float scale = maximum > 0 ? 255.0f / maximum : 0;
+
+    fprintf(file, "P5\n%u %u\n255\n", imageWidth, imageHeight);
+    for(size_t index = 0; index < (size_t)imageWidth * imageHeight; ++index)
+    {
+        fputc((int)(image[index] * scale + 0.5f), file);
+    }
+
+    return fclose(file) == 0;
+}
+
+// Internal Functions ---------------------------------------------------------------------------------------------------------
+
+void cursorClamp(xyCoord_t* x, xyCoord_t* y)
+{
+    if(screenWrap)
+    {
+        while(*x < 0) *x += screenWidth;
+        while(*y < 0) *y += screenHeight;
+        *x %= screenWidth;
+        *y %= screenHeight;
+    }
+    else
+    {
+        if(*x < 0) *x = 0;
+        if(*x >= screenWidth) *x = screenWidth - 1;
+        if(*y < 0) *y = 0;
+        if(*y >= screenHeight) *y = screenHeight - 1;
+    }
+}
+
+void beamMove(xyCoord_t x, xyCoord_t y)
+{
+    strokeEnd();
+
+    double deltaX = (double)x - cursorX;
+    double deltaY = (double)y - cursorY;
+
+    beamTravel   = deltaX != 0 || deltaY != 0;
+    strokeLength = sqrt(deltaX * deltaX + deltaY * deltaY);
+
+    // Holding still after a color change is waiting on the color, moving ends the wait
+    if(beamTravel) beamColorHold = false;
+
+    cursorX = x;
+    cursorY = y;
+    ++frameCurrent.moveCount;
+    eventRecord(false);
+}
+
+void beamColor(xyColor_t red, xyColor_t green, xyColor_t blue)
+{
+    strokeEnd();
+
+    cursorRgb.red   = red;
+    cursorRgb.green = green;
+    cursorRgb.blue  = blue;
+
+    // Same luma conversion as the Z output
+    xyColor_t z = ((uint32_t)red * 21 + (uint32_t)green * 72 + (uint32_t)blue * 7) / 100;
+    beamIntensity = z / 255.0;
+    beamTravel    = false;
+    beamColorHold = true;
+    strokeLength  = 0;
+
+    ++frameCurrent.colorCount;
+    eventRecord(true);
+}
+
+void beamIntegrate(uint64_t ticks)
+{
+    if(ticks == 0) return;
+
+    // Metrics
+    frameCurrent.periodTicks += ticks;
+    if(beamIntensity > 0) frameCurrent.litTicks += ticks;
+    else frameCurrent.blankTicks += ticks;
+    if(beamIntensity == 0 && beamTravel) frameCurrent.travelTicks += ticks;
+    if(beamColorHold) frameCurrent.colorTicks += ticks;
+    strokeEnergy += beamIntensity * ticks;
+
+    double decay = exp(-1.0 / ((double)rcConstantUs * XY_STREAM_TICKS_PER_US));
+
+    if(image != NULL && beamIntensity > 0)
+    {
+        // Integrate tick by tick, depositing energy as the beam moves
+        for(uint64_t tick = 0; tick < ticks; ++tick)
+        {
+            beamX = cursorX + (beamX - cursorX) * decay;
+            beamY = cursorY + (beamY - cursorY) * decay;
+            imageSplat(beamX, beamY, beamIntensity);
+        }
+    }
+    else
+    {
+        // Closed form, nothing to deposit
+        double decayTotal = pow(decay, (double)ticks);
+        beamX = cursorX + (beamX - cursorX) * decayTotal;
+        beamY = cursorY + (beamY - cursorY) * decayTotal;
+    }
+
+    hostTime += ticks;
+}
+
+void strokeEnd()
+{
+    // Only lit moves of at least a pixel count as strokes, lit holds are dots
+    if(beamIntensity > 0 && strokeLength >= 1.0)
+    {
+        double brightness = strokeEnergy / strokeLength;
+        strokeWeight     += strokeLength;
+        strokeSum        += brightness * strokeLength;
+        strokeSumSquares += brightness * brightness * strokeLength;
+    }
+
+    strokeEnergy = 0;
+    strokeLength = 0;
+}
+
+void frameEnd()
+{
+    strokeEnd();
+
+    if(strokeWeight > 0)
+    {
+        double mean = strokeSum / strokeWeight;
+        frameCurrent.strokeBrightnessMean     = mean;
+        frameCurrent.strokeBrightnessVariance = strokeSumSquares / strokeWeight - mean * mean;
+    }
+
+    frameLast  = frameCurrent;
+    frameValid = true;
+
+    memset(&frameCurrent, 0, sizeof(frameCurrent));
+    strokeWeight     = 0;
+    strokeSum        = 0;
+    strokeSumSquares = 0;
+
+    imageDecay();
+}
+
+void eventRecord(bool color)
+{
+    if(!recording) return;
+
+    if(eventCount >= eventCapacity)
+    {
+        uint32_t capacity = eventCapacity == 0 ? 1024 : eventCapacity * 2;
+        xyHostEvent_t* resized = realloc(events, capacity * sizeof(xyHostEvent_t));
+        if(resized == NULL) return;
+
+        events        = resized;
+        eventCapacity = capacity;
+    }
+
+    xyHostEvent_t* event = &events[eventCount];
+    event->timeTicks = hostTime;
+    event->color     = color;
+    event->x         = cursorX;
+    event->y         = cursorY;
+    event->rgb       = cursorRgb;
+    ++eventCount;
+}
+
+void imageSplat(double x, double y, double energy)
+{
+    // Screen to image coordinates, the image's top row is the top of the screen
+    double imageX = (x + 0.5) * imageWidth / screenWidth - 0.5;
+    double imageY = (screenHeight - 0.5 - y) * imageHeight / screenHeight - 0.5;
+
+    int32_t left   = (int32_t)floor(imageX);
+    int32_t top    = (int32_t)floor(imageY);
+    double  right  = imageX - left;
+    double  bottom = imageY - top;
+
+    // Bilinear weights of the 4 neighbouring pixels
+    double weights[4] = { (1 - right) * (1 - bottom), right * (1 - bottom), (1 - right) * bottom, right * bottom };
+
+    for(uint8_t index = 0; index < 4; ++index)
+    {
+        int32_t pixelX = left + (index & 1);
+        int32_t pixelY = top + (index >> 1);
+        if(pixelX < 0 || pixelY < 0 || pixelX >= imageWidth || pixelY >= imageHeight) continue;
+
+        image[(size_t)pixelY * imageWidth + pixelX] += (float)(energy * weights[index]);
+    }
+}
+
+void imageDecay()
+{
+    if(image == NULL || imagePersistenceUs == 0 || hostTime == imageDecayTime)
+    {
+        imageDecayTime = hostTime;
+        return;
+    }
+
+    float factor = (float)exp(-(double)(hostTime - imageDecayTime) / ((double)imagePersistenceUs * XY_STREAM_TICKS_PER_US));
+    for(size_t index = 0; index < (size_t)imageWidth * imageHeight; ++index) image[index] *= factor;
+
+    imageDecayTime = hostTime;
+}
+
+uint16_t engineRun(uint64_t untilTicks, uint16_t frameLimit)
+{
+    uint16_t frames = 0;
+
+    while(hostTime < untilTicks && frames < frameLimit)
+    {
+        // Start of a sample, write the output word
+        if(streamRemaining == 0)
+        {
+            if(!sampleLoaded) sampleLoaded = enginePull(&sampleNext);
+
+            // Idle engine, hold still
+            if(!sampleLoaded)
+            {
+                if(untilTicks != UINT64_MAX) beamIntegrate(untilTicks - hostTime);
+                break;
+            }
+
+            sampleCurrent = sampleNext;
+            sampleLoaded  = false;
+
+            uint32_t output = (sampleCurrent.sample & 0xFFFF) << streamPinBase;
+            beamMove((output & portXMask) >> portXOffset, (output & portYMask) >> portYOffset);
+
+            streamRemaining = xyGetSampleTicks(sampleCurrent.sample);
+        }
+
+        // Dwell
+        uint64_t ticks = streamRemaining;
+        if(ticks > untilTicks - hostTime) ticks = untilTicks - hostTime;
+        beamIntegrate(ticks);
+        streamRemaining -= ticks;
+
+        if(streamRemaining != 0) continue;
+
+        // End of the sample. Autopull loads the next sample as the last bits of this one are shifted out, before the sync is
+        // raised, so the DMA may already be feeding the next frame.
+        sampleLoaded = enginePull(&sampleNext);
+
+        if(sampleCurrent.sample & XY_SAMPLE_SYNC) engineSync();
+
+        // End of a frame
+        if(sampleCurrent.last)
+        {
+            frameCurrent.stream = sampleCurrent.stream;
+            frameEnd();
+            ++frames;
+        }
+    }
+
+    return frames;
+}
+
+void engineFrame()
+{
+    // Switch to the pending stream
+    if(streamPending != NULL)
+    {
+        streamPlaying       = streamPending;
+        streamPending       = NULL;
+        streamPlayingFrames = 0;
+        ++streamPickups;
+
+        // The FIFO may still hold syncs of the previous stream, its colors are needed until they have been applied
+        if(streamColorFrames == 0) engineColorNext();
+    }
+
+    // Count the frames whose colors are yet to be applied
+    if(streamPlaying->colorCount != 0)
+    {
+        if(streamColor == streamPlaying) ++streamColorFrames;
+        else ++streamPlayingFrames;
+    }
+
+    streamSampleIndex = 0;
+    streamFeeding     = true;
+}
+
+void engineFeed()
+{
+    while(streamFeeding && fifoCount < FIFO_DEPTH)
+    {
+        fifoEntry_t* entry = &fifo[(fifoHead + fifoCount) % FIFO_DEPTH];
+        entry->sample = streamPlaying->samples[streamSampleIndex];
+        entry->stream = streamPickups;
+        entry->last   = streamSampleIndex + 1 >= streamPlaying->sampleCount;
+        ++fifoCount;
+        ++streamSampleIndex;
+
+        // Frame fed, start the next unless stopping
+        if(entry->last)
+        {
+            streamFeeding = false;
+            ++streamFrames;
+            if(streamActive) engineFrame();
+        }
+    }
+}
+
+bool enginePull(fifoEntry_t* entry)
+{
+    engineFeed();
+    if(fifoCount == 0) return false;
+
+    *entry   = fifo[fifoHead];
+    fifoHead = (fifoHead + 1) % FIFO_DEPTH;
+    --fifoCount;
+
+    engineFeed();
+    return true;
+}
+
+void engineSync()
+{
+    xyRgb_t color = streamColor->colors[streamColorIndex];
+    ++streamColorIndex;
+    beamColor(color.red, color.green, color.blue);
+
+    // Once the last frame of a replaced stream is done, move on to the playing stream
+    if(streamColorIndex >= streamColor->colorCount)
+    {
+        streamColorIndex = 0;
+        --streamColorFrames;
+        if(streamColorFrames == 0 && streamColor != streamPlaying) engineColorNext();
+    }
+}
+
+void engineColorNext()
+{
+    streamColor         = streamPlaying;
+    streamColorIndex    = 0;
+    streamColorFrames   = streamPlayingFrames;
+    streamPlayingFrames = 0;
+}
@@ -30,15 +30,39 @@
 //
 // Knowing this, after updating the cursor to move X_i pixels horizontally and Y_i pixels vertically, a delay no shorter than
 // t_1 must be applied before the next update may occur.
+//
+// As t_1 only depends on the larger of X_i and Y_i, it is tabulated for every step size up to RC_DELAY_TABLE_SIZE when the
+// timing is set up. The Cortex-M0+ has no FPU, evaluating the logarithm for every point is far too slow for the hot path.
+//
+// Stream Output --------------------------------------------------------------------------------------------------------------
+//
+// The output engine uses a PIO state machine to write the X-Y ports (see 'xy_stream.pio'), fed by a DMA channel. Each frame
+// is a single DMA transfer of the entire stream, after which the DMA interrupt restarts the transfer with either the same
+// stream or the pending one. As the PIO FIFO is never drained between frames, there is no gap at frame boundaries.
+//
+// Color changes are the only points at which the CPU is involved. A sample with the sync flag set causes the state machine
+// to stall and raise an interrupt, in which the next color of the stream is written to the PWM outputs. The dwell of the
+// sample following the sync is responsible for waiting for the output to settle.
 
 // Libraries ------------------------------------------------------------------------------------------------------------------
 
 // Raspberry Pi Pico
 #include <pico/stdlib.h>
 #include <hardware/pwm.h>
+#include <hardware/pio.h>
+#include <hardware/dma.h>
+#include <hardware/irq.h>
+#include <hardware/clocks.h>
 
-// C Standard Libraries
-#include <math.h>
+// PIO Programs
+#include "xy_stream.pio.h"
+
+// X-Y Library
+#include "xy_math.h"
+
+// Constants ------------------------------------------------------------------------------------------------------------------
+
+#define RC_DELAY_TABLE_SIZE 1024         // Number of step sizes to tabulate the RC delay of, covers screens up to 10-bit.
 
 // Global Data ----------------------------------------------------------------------------------------------------------------
 
@@ -66,9 +90,51 @@ static xyCoord_t cursorY       = 0;      // Current y position of the cursor (no
 
 static uint16_t rcConstantUs   = 1;      // RC time constant of the output low-pass filter, in us.
 static uint16_t rcThreshold    = 1;      // Minimum acceptable error in the cursor position due to RC filtering.
+static uint16_t rcDelayTable[RC_DELAY_TABLE_SIZE]; // Delay in us after a move, indexed by the larger of the X & Y steps.
 
 static uint16_t rgbzDelay      = 0;      // Minimum amount of time to wait after
 
+static PIO      streamPio      = pio0;   // PIO block of the output engine.
+static int16_t  streamSm       = -1;     // PIO state machine of the output engine, -1 if unclaimed.
+static uint16_t streamOffset   = 0;      // Instruction memory offset of the output engine program.
+static int16_t  streamDma      = -1;     // DMA channel of the output engine, -1 if unclaimed.
+static uint16_t streamPinBase  = 0;      // First pin of the output word (lowest pin of the X & Y ports).
+
+static volatile bool              streamActive        = false; // Indicates whether the output engine is running.
+static const xyStream_t* volatile streamPlaying       = NULL;  // Stream currently being fed to the PIO.
+static const xyStream_t* volatile streamPending       = NULL;  // Stream to play at the next frame boundary.
+static const xyStream_t* volatile streamColor         = NULL;  // Stream whose colors are currently being applied.
+static volatile uint16_t          streamColorIndex    = 0;     // Index of the next color to apply.
+static volatile uint16_t          streamColorFrames   = 0;     // Frames of the color stream fed to the PIO, colors pending.
+static volatile uint16_t          streamPlayingFrames = 0;     // Same, of the playing stream while not the color stream.
+static volatile uint32_t          streamFrames        = 0;     // Number of frames completed since the engine was started.
+
+// Function Prototypes --------------------------------------------------------------------------------------------------------
+
+// Clamp Cursor
+// - Call to clamp / wrap the specified coordinates depending on the screen settings.
+void cursorClamp(xyCoord_t* x, xyCoord_t* y);
+
+// Output Color
+// - Call to write the specified color to the RGB / Z outputs, without waiting for them to settle.
+void outputColor(xyColor_t red, xyColor_t green, xyColor_t blue);
+
+// Stream Next Frame
+// - Call to start the DMA transfer of the next frame, switching to the pending stream if there is one.
+void streamNext();
+
+// Stream Next Colors
+// - Call to move on to the colors of the playing stream, releasing the previous stream.
+void streamColorNext();
+
+// Stream DMA Handler
+// - Interrupt handler for the completion of a frame's DMA transfer.
+void streamDmaHandler();
+
+// Stream PIO Handler
+// - Interrupt handler for the sync flag of the output engine.
+void streamPioHandler();
+
 // Functions ------------------------------------------------------------------------------------------------------------------
 
 void xySetupXy(uint16_t portXOffset_, uint16_t portXSize, uint16_t portYOffset_, uint16_t portYSize)
@@ -83,6 +149,12 @@ void xySetupXy(uint16_t portXOffset_, uint16_t portXSize, uint16_t portYOffset_,
     screenWidth  = 1 << portXSize;
     screenHeight = 1 << portYSize;
 
+    // Output word of the stream begins at the lowest pin
+    streamPinBase = portXOffset < portYOffset ? portXOffset : portYOffset;
+
+    // Tabulate default RC timing
+    xyRcSettlingTable(rcDelayTable, RC_DELAY_TABLE_SIZE, rcConstantUs, rcThreshold);
+
     // Configure X parallel port
     for(uint16_t index = portXOffset; index < portXOffset + portXSize; ++index)
     {
@@ -198,6 +270,9 @@ void xySetupRcTiming(uint16_t rcConstantUs_, uint16_t rcPixelThreshold_)
 {
     rcConstantUs = rcConstantUs_;
     rcThreshold  = rcPixelThreshold_;
+
+    // Tabulate delays
+    xyRcSettlingTable(rcDelayTable, RC_DELAY_TABLE_SIZE, rcConstantUs, rcThreshold);
 }
 
 void xySetupScreen(xyCoord_t width, xyCoord_t height, bool wrap)
@@ -210,27 +285,7 @@ void xySetupScreen(xyCoord_t width, xyCoord_t height, bool wrap)
 void xyCursorMove(xyCoord_t x, xyCoord_t y)
 {
     // Clamp / wrap cursor
-    if(x >= screenWidth)
-    {
-        if(screenWrap) while(x >= screenWidth) x -= screenWidth;
-        else x = screenWidth - 1;
-    }
-    else if(x < 0)
-    {
-        if(screenWrap) while(x < screenWidth) x += screenWidth;
-        else x = 0;
-    }
-
-    if(y >= screenHeight)
-    {
-        if(screenWrap) while(y >= screenHeight) y -= screenHeight;
-        else y = screenHeight - 1;
-    }
-    else if(y < 0)
-    {
-        if(screenWrap) while(y < screenHeight) x += screenHeight;
-        else y = 0;
-    }
+    cursorClamp(&x, &y);
 
     // Store position
     cursorX = x;
@@ -243,6 +298,32 @@ void xyCursorMove(xyCoord_t x, xyCoord_t y)
 }
 
 void xyCursorColor(xyColor_t red, xyColor_t green, xyColor_t blue)
+{
+    outputColor(red, green, blue);
+
+    // Wait for output to be valid.
+    sleep_us(rgbzDelay);
+}
+
+xySample_t xyGetSample(xyCoord_t x, xyCoord_t y, uint16_t dwellTicks)
+{
+    cursorClamp(&x, &y);
+
+    uint32_t outputValue = ((uint32_t)x << portXOffset) & portXMask | ((uint32_t)y << portYOffset) & portYMask;
+
+    // Each sample has a fixed overhead of 5 cycles (see 'xy_stream.pio')
+    if(dwellTicks > XY_SAMPLE_DWELL_MAX) dwellTicks = XY_SAMPLE_DWELL_MAX;
+    uint32_t dwellCount = dwellTicks > 5 ? dwellTicks - 5 : 0;
+
+    return (outputValue >> streamPinBase) & 0xFFFF | dwellCount << XY_SAMPLE_DWELL_SHIFT;
+}
+
+uint16_t xyGetSampleTicks(xySample_t sample)
+{
+    return ((sample & ~XY_SAMPLE_SYNC) >> XY_SAMPLE_DWELL_SHIFT) + 5;
+}
+
+void outputColor(xyColor_t red, xyColor_t green, xyColor_t blue)
 {
     if(pwmSliceRed   != -1) pwm_set_chan_level(pwmSliceRed,   pwmChannelRed,   255 - red);
     if(pwmSliceGreen != -1) pwm_set_chan_level(pwmSliceGreen, pwmChannelGreen, 255 - green);
@@ -254,39 +335,30 @@ void xyCursorColor(xyColor_t red, xyColor_t green, xyColor_t blue)
         xyColor_t z = ((uint32_t)red * 21 + (uint32_t)green * 72 + (uint32_t)blue * 7) / 100;
         pwm_set_chan_level(pwmSliceZ, pwmChannelZ, 255 - z);
     }
-
-    // Wait for output to be valid.
-    sleep_us(rgbzDelay);
 }
 
 uint16_t xyGetCursorDelayUs(xyCoord_t x, xyCoord_t y)
 {
-    xyCoord_t deltaX = x - cursorX;
-    xyCoord_t deltaY = y - cursorY;
-    xyCoord_t deltaMax = 0;
-
-    if(deltaX < 0) deltaX = -deltaX;
-    if(deltaY < 0) deltaY = -deltaY;
-    if(deltaX > deltaY) deltaMax = deltaX;
-    else deltaMax = deltaY;
-
-    if(deltaMax <= rcThreshold) return 1;
-    return ceilf(-rcConstantUs * logf((float)rcThreshold / deltaMax));
+    return xyGetMoveDelayUs(cursorX, cursorY, x, y);
 }
 
 uint16_t xyGetMoveDelayUs(xyCoord_t x1, xyCoord_t y1, xyCoord_t x2, xyCoord_t y2)
 {
-    xyCoord_t deltaX = x2 - x1;
-    xyCoord_t deltaY = y2 - y1;
-    xyCoord_t deltaMax = 0;
+    xyCoordLong_t deltaX = (xyCoordLong_t)x2 - x1;
+    xyCoordLong_t deltaY = (xyCoordLong_t)y2 - y1;
 
     if(deltaX < 0) deltaX = -deltaX;
     if(deltaY < 0) deltaY = -deltaY;
-    if(deltaX > deltaY) deltaMax = deltaX;
-    else deltaMax = deltaY;
+    xyCoordLong_t deltaMax = deltaX > deltaY ? deltaX : deltaY;
+
+    // Steps larger than the table are only possible on screens wider than 10-bit
+    if(deltaMax >= RC_DELAY_TABLE_SIZE) return xyRcSettlingUs(deltaMax, rcConstantUs, rcThreshold);
+    return rcDelayTable[deltaMax];
+}
 
-    if(deltaMax <= rcThreshold) return 1;
-    return ceilf(-rcConstantUs * logf((float)rcThreshold / deltaMax));
+uint16_t xyGetColorDelayUs()
+{
+    return rgbzDelay;
 }
 
 xyCoord_t xyScreenWidth()
@@ -308,3 +380,214 @@ xyCoord_t xyCursorY()
 {
     return cursorY;
 }
+
+void xyStreamStart()
+{
+    // Ignore repeated calls
+    if(streamActive) return;
+
+    // Claim resources
+    if(streamSm == -1)
+    {
+        streamSm     = pio_claim_unused_sm(streamPio, true);
+        streamOffset = pio_add_program(streamPio, &xy_stream_program);
+        streamDma    = dma_claim_unused_channel(true);
+    }
+
+    // Hand X-Y ports to the PIO
+    for(uint16_t index = 0; index < 32; ++index)
+    {
+        if((portXMask | portYMask) & (1u << index)) pio_gpio_init(streamPio, index);
+    }
+    pio_sm_set_consecutive_pindirs(streamPio, streamSm, streamPinBase, 16, true);
+
+    // Configure state machine
+    // - Samples are shifted out LSB first, 32-bit autopull. TX FIFO is joined for the deepest buffer possible.
+    pio_sm_config config = xy_stream_program_get_default_config(streamOffset);
+    sm_config_set_out_pins(&config, streamPinBase, 16);
+    sm_config_set_out_shift(&config, true, true, 32);
+    sm_config_set_fifo_join(&config, PIO_FIFO_JOIN_TX);
+    sm_config_set_clkdiv(&config, (float)clock_get_hz(clk_sys) / (XY_STREAM_TICKS_PER_US * 1000000));
+    pio_sm_init(streamPio, streamSm, streamOffset + xy_stream_offset_start, &config);
+
+    // Configure sync interrupt
+    // - Shares the frame counters with the DMA handler. Both run at the default priority on this core, so neither preempts
+    //   the other.
+    pio_interrupt_clear(streamPio, streamSm);
+    pio_set_irq0_source_enabled(streamPio, pis_interrupt0 + streamSm, true);
+    irq_set_exclusive_handler(PIO0_IRQ_0, streamPioHandler);
+    irq_set_enabled(PIO0_IRQ_0, true);
+
+    // Configure DMA, paced by the state machine's TX FIFO
+    dma_channel_config dmaConfig = dma_channel_get_default_config(streamDma);
+    channel_config_set_transfer_data_size(&dmaConfig, DMA_SIZE_32);
+    channel_config_set_read_increment(&dmaConfig, true);
+    channel_config_set_write_increment(&dmaConfig, false);
+    channel_config_set_dreq(&dmaConfig, pio_get_dreq(streamPio, streamSm, true));
+    dma_channel_configure(streamDma, &dmaConfig, &streamPio->txf[streamSm], NULL, 0, false);
+
+    dma_channel_set_irq0_enabled(streamDma, true);
+    irq_set_exclusive_handler(DMA_IRQ_0, streamDmaHandler);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    // Start with the beam off
+    outputColor(0, 0, 0);
+
+    streamPlaying       = NULL;
+    streamColor         = NULL;
+    streamColorIndex    = 0;
+    streamColorFrames   = 0;
+    streamPlayingFrames = 0;
+    streamFrames        = 0;
+    streamActive        = true;
+
+    pio_sm_set_enabled(streamPio, streamSm, true);
+
+    // Start playback if a stream has already been submitted
+    if(streamPending != NULL) streamNext();
+}
+
+void xyStreamStop()
+{
+    // Ignore repeated calls
+    if(!streamActive) return;
+
+    // Let the current frame finish
+    streamActive = false;
+    while(dma_channel_is_busy(streamDma)) tight_loop_contents();
+    while(!pio_sm_is_tx_fifo_empty(streamPio, streamSm)) tight_loop_contents();
+
+    // Delay long enough for the last sample to elapse
+    sleep_us(XY_SAMPLE_DWELL_MAX / XY_STREAM_TICKS_PER_US + 1);
+
+    // Stop the engine
+    pio_sm_set_enabled(streamPio, streamSm, false);
+    pio_sm_clear_fifos(streamPio, streamSm);
+    pio_interrupt_clear(streamPio, streamSm);
+    irq_set_enabled(PIO0_IRQ_0, false);
+    irq_set_enabled(DMA_IRQ_0, false);
+
+    streamPlaying       = NULL;
+    streamColor         = NULL;
+    streamColorIndex    = 0;
+    streamColorFrames   = 0;
+    streamPlayingFrames = 0;
+
+    // Return X-Y ports to the CPU
+    for(uint16_t index = 0; index < 32; ++index)
+    {
+        if((portXMask | portYMask) & (1u << index)) gpio_set_function(index, GPIO_FUNC_SIO);
+    }
+
+    // Blank cursor
+    outputColor(0, 0, 0);
+}
+
+void xyStreamSubmit(const xyStream_t* stream)
+{
+    streamPending = stream;
+
+    // Start playback if the engine is waiting on its first stream
+    if(streamActive && streamPlaying == NULL) streamNext();
+}
+
+bool xyStreamPending()
+{
+    // The replaced stream is in use until the PIO has applied its last color
+    return streamPending != NULL || streamColor != streamPlaying;
+}
+
+uint32_t xyStreamFrames()
+{
+    return streamFrames;
+}
+
+void streamNext()
+{
+    // Switch to the pending stream
+    if(streamPending != NULL)
+    {
+        streamPlaying       = streamPending;
+        streamPending       = NULL;
+        streamPlayingFrames = 0;
+
+        // The FIFO may still hold syncs of the previous stream, its colors are needed until the PIO has consumed them
+        if(streamColorFrames == 0) streamColorNext();
+    }
+
+    // Count the frames whose colors are yet to be applied, the PIO trails the DMA by up to a FIFO's worth of samples
+    if(streamPlaying->colorCount != 0)
+    {
+        if(streamColor == streamPlaying) ++streamColorFrames;
+        else ++streamPlayingFrames;
+    }
+
+    dma_channel_transfer_from_buffer_now(streamDma, streamPlaying->samples, streamPlaying->sampleCount);
+}
+
+void streamColorNext()
+{
+    streamColor         = streamPlaying;
+    streamColorIndex    = 0;
+    streamColorFrames   = streamPlayingFrames;
+    streamPlayingFrames = 0;
+
+    // Wake anything waiting on the previous stream to be released
+    __sev();
+}
+
+void streamDmaHandler()
+{
+    // Acknowledge interrupt
+    dma_hw->ints0 = 1u << streamDma;
+
+    // The last sample of the frame has been handed to the PIO
+    ++streamFrames;
+
+    // Start next frame, unless stopping
+    if(streamActive) streamNext();
+}
+
+void streamPioHandler()
+{
+    xyRgb_t color = streamColor->colors[streamColorIndex];
+    ++streamColorIndex;
+    outputColor(color.red, color.green, color.blue);
+
+    // Colors are applied in order, frame after frame. Once the last frame of a replaced stream is done, move on to the
+    // playing stream.
+    if(streamColorIndex >= streamColor->colorCount)
+    {
+        streamColorIndex = 0;
+        --streamColorFrames;
+        if(streamColorFrames == 0 && streamColor != streamPlaying) streamColorNext();
+    }
+
+    // Release state machine
+    pio_interrupt_clear(streamPio, streamSm);
+}
+
+void cursorClamp(xyCoord_t* x, xyCoord_t* y)
+{
+    if(*x >= screenWidth)
+    {
+        if(screenWrap) while(*x >= screenWidth) *x -= screenWidth;
+        else *x = screenWidth - 1;
+    }
+    else if(*x < 0)
+    {
+        if(screenWrap) while(*x < 0) *x += screenWidth;
+        else *x = 0;
+    }
+
+    if(*y >= screenHeight)
+    {
+        if(screenWrap) while(*y >= screenHeight) *y -= screenHeight;
+        else *y = screenHeight - 1;
+    }
+    else if(*y < 0)
+    {
+        if(screenWrap) while(*y < 0) *y += screenHeight;
+        else *y = 0;
+    }
+}
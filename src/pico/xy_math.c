@@ -1,6 +1,13 @@
 // Header
 #include "xy_math.h"
 
+// Libraries ------------------------------------------------------------------------------------------------------------------
+
+// C Standard Libraries
+#include <math.h>
+
+// Lookup Tables --------------------------------------------------------------------------------------------------------------
+
 uint8_t cos256x256Unsigned[256] =
 {
     255, 255, 255, 255, 254, 254, 254, 253, 253, 252, 251, 250, 250, 249, 248, 246,
@@ -79,4 +86,71 @@ int8_t sin256x256Signed[256] =
    -117,-116,-115,-113,-112,-111,-109,-107,-106,-104,-102,-100, -98, -96, -94, -92,
     -90, -88, -85, -83, -81, -78, -76, -73, -71, -68, -65, -63, -60, -57, -54, -51,
     -49, -46, -43, -40, -37, -34, -31, -28, -25, -22, -19, -16, -12,  -9,  -6,  -3
-};
\ No newline at end of file
+};
+
+uint16_t sinQuarter257Q15[257] =
+{
+        0,   201,   402,   603,   804,  1005,  1206,  1407,  1608,  1809,  2009,  2210,
+     2411,  2611,  2811,  3012,  3212,  3412,  3612,  3812,  4011,  4211,  4410,  4609,
+     4808,  5007,  5205,  5404,  5602,  5800,  5998,  6195,  6393,  6590,  6787,  6983,
+     7180,  7376,  7571,  7767,  7962,  8157,  8351,  8546,  8740,  8933,  9127,  9319,
+     9512,  9704,  9896, 10088, 10279, 10469, 10660, 10850, 11039, 11228, 11417, 11605,
+    11793, 11980, 12167, 12354, 12540, 12725, 12910, 13095, 13279, 13463, 13646, 13828,
+    14010, 14192, 14373, 14553, 14733, 14912, 15091, 15269, 15447, 15624, 15800, 15976,
+    16151, 16326, 16500, 16673, 16846, 17018, 17190, 17361, 17531, 17700, 17869, 18037,
+    18205, 18372, 18538, 18703, 18868, 19032, 19195, 19358, 19520, 19681, 19841, 20001,
+    20160, 20318, 20475, 20632, 20788, 20943, 21097, 21251, 21403, 21555, 21706, 21856,
+    22006, 22154, 22302, 22449, 22595, 22740, 22884, 23028, 23170, 23312, 23453, 23593,
+    23732, 23870, 24008, 24144, 24279, 24414, 24548, 24680, 24812, 24943, 25073, 25202,
+    25330, 25457, 25583, 25708, 25833, 25956, 26078, 26199, 26320, 26439, 26557, 26674,
+    26791, 26906, 27020, 27133, 27246, 27357, 27467, 27576, 27684, 27791, 27897, 28002,
+    28106, 28209, 28311, 28411, 28511, 28610, 28707, 28803, 28899, 28993, 29086, 29178,
+    29269, 29359, 29448, 29535, 29622, 29707, 29792, 29875, 29957, 30038, 30118, 30196,
+    30274, 30350, 30425, 30499, 30572, 30644, 30715, 30784, 30853, 30920, 30986, 31050,
+    31114, 31177, 31238, 31298, 31357, 31415, 31471, 31527, 31581, 31634, 31686, 31737,
+    31786, 31834, 31881, 31927, 31972, 32015, 32058, 32099, 32138, 32177, 32214, 32251,
+    32286, 32319, 32352, 32383, 32413, 32442, 32470, 32496, 32522, 32546, 32568, 32590,
+    32610, 32629, 32647, 32664, 32679, 32693, 32706, 32718, 32729, 32738, 32746, 32753,
+    32758, 32762, 32766, 32767, 32768
+};
+
+// Fixed-Point ----------------------------------------------------------------------------------------------------------------
+
+xyFixed_t xyFixedSin(xyAngle_t theta)
+{
+    // Fold the angle into the first quadrant, the odd quadrants are mirrored
+    uint16_t quadrant = theta >> 14;
+    uint16_t phase    = theta & 0x3FFF;
+    if(quadrant & 1) phase = 0x4000 - phase;
+
+    // Interpolate between the neighbouring entries, 64 angles apart
+    uint16_t index    = phase >> 6;
+    uint16_t fraction = phase & 0x3F;
+    int32_t  value    = sinQuarter257Q15[index];
+    if(fraction != 0) value += ((sinQuarter257Q15[index + 1] - value) * fraction + 32) >> 6;
+
+    // Q15 to Q16.16, the lower half of the wave is negative
+    value <<= 1;
+    return (quadrant & 2) ? -value : value;
+}
+
+xyFixed_t xyFixedCos(xyAngle_t theta)
+{
+    return xyFixedSin((xyAngle_t)(theta + 0x4000));
+}
+
+// RC Settling ----------------------------------------------------------------------------------------------------------------
+
+uint16_t xyRcSettlingUs(uint32_t delta, uint16_t rcConstantUs, uint16_t rcThreshold)
+{
+    if(delta <= rcThreshold) return 1;
+    return ceilf(-rcConstantUs * logf((float)rcThreshold / delta));
+}
+
+void xyRcSettlingTable(uint16_t* table, uint16_t tableSize, uint16_t rcConstantUs, uint16_t rcThreshold)
+{
+    for(uint16_t delta = 0; delta < tableSize; ++delta)
+    {
+        table[delta] = xyRcSettlingUs(delta, rcConstantUs, rcThreshold);
+    }
+}
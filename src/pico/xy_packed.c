@@ -0,0 +1,224 @@
+// Header
+#include "xy_packed.h"
+
+// Libraries ------------------------------------------------------------------------------------------------------------------
+
+// C Standard Libraries
+#include <stddef.h>
+
+// Constants ------------------------------------------------------------------------------------------------------------------
+
+#define PACKED_ESCAPE 0xFF               // Delta byte followed by 2 varints.
+
+// Function Prototypes --------------------------------------------------------------------------------------------------------
+
+// Read / Write Varint
+// - Call to decode / encode a varint, advancing the pointer past it. Writing with a NULL buffer only counts the bytes.
+uint32_t packedReadVarint(const uint8_t** data);
+uint32_t packedWriteVarint(uint8_t* buffer, uint32_t value);
+
+// Zig-Zag Encode / Decode
+// - Call to map a signed value to an unsigned one and vice-versa.
+uint32_t packedZigZag(int32_t value);
+int32_t packedUnZigZag(uint32_t value);
+
+// Encode Delta
+// - Call to encode the offset between 2 points, returns the number of bytes written. Writing with a NULL buffer only counts
+//   the bytes.
+uint32_t packedWriteDelta(uint8_t* buffer, xyPoint_t previous, xyPoint_t point);
+
+// Function Definitions -------------------------------------------------------------------------------------------------------
+
+const uint8_t* xyPackedFrame(const uint8_t* animation, uint16_t index)
+{
+    const uint8_t* offset = animation + 2 + 4 * (uint32_t)index;
+    return animation + (offset[0] | offset[1] << 8 | offset[2] << 16 | (uint32_t)offset[3] << 24);
+}
+
+uint16_t xyPackedFrameCount(const uint8_t* animation)
+{
+    return animation[0] | animation[1] << 8;
+}
+
+uint16_t xyPackedCount(const uint8_t* frame)
+{
+    return packedReadVarint(&frame);
+}
+
+void xyPackedBegin(xyPackedReader_t* reader, const uint8_t* frame)
+{
+    reader->remaining = packedReadVarint(&frame);
+    reader->data      = frame;
+    reader->started   = false;
+    reader->x         = 0;
+    reader->y         = 0;
+}
+
+uint16_t xyPackedRead(xyPackedReader_t* reader, xyPoint_t* points, uint16_t count)
+{
+    if(count > reader->remaining) count = reader->remaining;
+    if(count == 0) return 0;
+
+    const uint8_t* data  = reader->data;
+    xyCoord_t      x     = reader->x;
+    xyCoord_t      y     = reader->y;
+    uint16_t       index = 0;
+
+    // First point is absolute
+    if(!reader->started)
+    {
+        x = data[0];
+        y = data[1];
+        data += 2;
+
+        points[0].x = x;
+        points[0].y = y;
+        index = 1;
+        reader->started = true;
+    }
+
+    for(; index < count; ++index)
+    {
+        uint8_t delta = *data++;
+
+        if(delta != PACKED_ESCAPE)
+        {
+            // Nibble zig-zag
+            x += (delta >> 5) ^ -((delta >> 4) & 1);
+            y += ((delta & 0x0F) >> 1) ^ -(delta & 1);
+        }
+        else
+        {
+            x += packedUnZigZag(packedReadVarint(&data));
+            y += packedUnZigZag(packedReadVarint(&data));
+        }
+
+        points[index].x = x;
+        points[index].y = y;
+    }
+
+    reader->data       = data;
+    reader->x          = x;
+    reader->y          = y;
+    reader->remaining -= count;
+
+    return count;
+}
+
+uint32_t xyPackedSize(const xyPoint_t* points, uint16_t count)
+{
+    uint32_t size = packedWriteVarint(NULL, count);
+    if(count == 0) return size;
+
+    size += 2;
+    for(uint16_t index = 1; index < count; ++index) size += packedWriteDelta(NULL, points[index - 1], points[index]);
+
+    return size;
+}
+
+uint32_t xyPackedEncode(const xyPoint_t* points, uint16_t count, uint8_t* buffer)
+{
+    uint32_t size = packedWriteVarint(buffer, count);
+    if(count == 0) return size;
+
+    buffer[size++] = points[0].x;
+    buffer[size++] = points[0].y;
+
+    for(uint16_t index = 1; index < count; ++index) size += packedWriteDelta(buffer + size, points[index - 1], points[index]);
+
+    return size;
+}
+
+uint32_t xyPackedAnimationSize(xyPoint_t* const* frames, const uint16_t* frameSizes, uint16_t frameCount)
+{
+    uint32_t size = 2 + 4 * ((uint32_t)frameCount + 1);
+    for(uint16_t index = 0; index < frameCount; ++index) size += xyPackedSize(frames[index], frameSizes[index]);
+
+    return size;
+}
+
+uint32_t xyPackedEncodeAnimation(xyPoint_t* const* frames, const uint16_t* frameSizes, uint16_t frameCount, uint8_t* buffer)
+{
+    buffer[0] = frameCount & 0xFF;
+    buffer[1] = frameCount >> 8;
+
+    uint32_t size = 2 + 4 * ((uint32_t)frameCount + 1);
+    for(uint16_t index = 0; index <= frameCount; ++index)
+    {
+        // Offset of the frame, the last being the end of the animation
+        uint8_t* offset = buffer + 2 + 4 * (uint32_t)index;
+        offset[0] = size & 0xFF;
+        offset[1] = (size >> 8) & 0xFF;
+        offset[2] = (size >> 16) & 0xFF;
+        offset[3] = size >> 24;
+
+        if(index < frameCount) size += xyPackedEncode(frames[index], frameSizes[index], buffer + size);
+    }
+
+    return size;
+}
+
+uint32_t packedReadVarint(const uint8_t** data)
+{
+    uint32_t value = 0;
+    uint8_t  shift = 0;
+    uint8_t  byte;
+
+    do
+    {
+        byte = *(*data)++;
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        shift += 7;
+    }
+    while(byte & 0x80);
+
+    return value;
+}
+
+uint32_t packedWriteVarint(uint8_t* buffer, uint32_t value)
+{
+    uint32_t size = 0;
+
+    do
+    {
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        if(value != 0) byte |= 0x80;
+
+        if(buffer != NULL) buffer[size] = byte;
+        ++size;
+    }
+    while(value != 0);
+
+    return size;
+}
+
+uint32_t packedZigZag(int32_t value)
+{
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+int32_t packedUnZigZag(uint32_t value)
+{
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+uint32_t packedWriteDelta(uint8_t* buffer, xyPoint_t previous, xyPoint_t point)
+{
+    uint32_t zx = packedZigZag((int32_t)point.x - previous.x);
+    uint32_t zy = packedZigZag((int32_t)point.y - previous.y);
+
+    // Single byte, unless it collides with the escape
+    if(zx < 16 && zy < 16 && (zx << 4 | zy) != PACKED_ESCAPE)
+    {
+        if(buffer != NULL) buffer[0] = zx << 4 | zy;
+        return 1;
+    }
+
+    if(buffer != NULL) buffer[0] = PACKED_ESCAPE;
+    uint32_t size = 1;
+    size += packedWriteVarint(buffer != NULL ? buffer + size : NULL, zx);
+    size += packedWriteVarint(buffer != NULL ? buffer + size : NULL, zy);
+
+    return size;
+}
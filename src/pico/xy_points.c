@@ -0,0 +1,65 @@
+// Header
+#include "xy_points.h"
+
+// Compilation Flags ----------------------------------------------------------------------------------------------------------
+
+// Use the SIO interpolators when building for the RP2040, unless the portable implementation is requested.
+#if defined(PICO_ON_DEVICE) && PICO_ON_DEVICE && !defined(XY_POINTS_PORTABLE)
+#define POINTS_INTERP
+#endif
+
+// Libraries ------------------------------------------------------------------------------------------------------------------
+
+#ifdef POINTS_INTERP
+
+// Pico Libraries
+#include <hardware/interp.h>
+
+#endif // POINTS_INTERP
+
+// Function Definitions -------------------------------------------------------------------------------------------------------
+
+#ifdef POINTS_INTERP
+
+// Interpolator Implementation
+// - Lane 0 processes X coordinates and lane 1 processes Y coordinates. Each point costs 2 accumulator writes and 2 result
+//   reads, the add is performed by the interpolator.
+
+void xyPointsOffset(const volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t count, xyCoord_t offsetX, xyCoord_t offsetY)
+{
+    interp_hw_save_t state;
+    interp_save(interp0, &state);
+
+    // Result = base + accumulator
+    interp_config config = interp_default_config();
+    interp_set_config(interp0, 0, &config);
+    interp_set_config(interp0, 1, &config);
+    interp0->base[0] = offsetX;
+    interp0->base[1] = offsetY;
+
+    for(uint16_t index = 0; index < count; ++index)
+    {
+        interp0->accum[0] = source[index].x;
+        interp0->accum[1] = source[index].y;
+        destination[index].x = (xyCoord_t)interp0->peek[0];
+        destination[index].y = (xyCoord_t)interp0->peek[1];
+    }
+
+    interp_restore(interp0, &state);
+}
+
+#else
+
+// Portable Implementation
+// - Mirrors the interpolator datapath: 32-bit add, truncated to the coordinate width.
+
+void xyPointsOffset(const volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t count, xyCoord_t offsetX, xyCoord_t offsetY)
+{
+    for(uint16_t index = 0; index < count; ++index)
+    {
+        destination[index].x = (xyCoord_t)((xyCoordLong_t)source[index].x + offsetX);
+        destination[index].y = (xyCoord_t)((xyCoordLong_t)source[index].y + offsetY);
+    }
+}
+
+#endif // POINTS_INTERP
@@ -3,8 +3,9 @@
 
 // Includes -------------------------------------------------------------------------------------------------------------------
 
-#include "xy_math.h"
+#include "xy_packed.h"
 #include "xy_shapes.h"
+#include "xy_stream.h"
 
 // Compilation Flags ----------------------------------------------------------------------------------------------------------
 
@@ -15,10 +16,10 @@
 // Pico Libraries
 #include <pico/stdlib.h>
 #include <pico/multicore.h>
+#include <hardware/sync.h>
 
 // C Standard Libraries
 #include <stdlib.h>
-#include <math.h>
 
 // Debugging Libraries
 #ifdef RENDERER_DEBUG
@@ -27,52 +28,192 @@
 
 // Constants ------------------------------------------------------------------------------------------------------------------
 
-#define RENDER_STACK_SIZE 256            // Maximum number of shapes being rendered in a single frame, may be modified.
+// Capacities may be overridden by the build (ex. '-DRENDER_STACK_SIZE=1024')
+#ifndef RENDER_STACK_SIZE
+#define RENDER_STACK_SIZE   256          // Maximum number of shapes being rendered in a single frame, at most 65535.
+#endif // RENDER_STACK_SIZE
+
+#ifndef RENDER_SAMPLE_COUNT
+#define RENDER_SAMPLE_COUNT 4096         // Maximum number of samples in a single frame.
+#endif // RENDER_SAMPLE_COUNT
+
+#ifndef RENDER_COLOR_COUNT
+#define RENDER_COLOR_COUNT  512          // Maximum number of color changes in a single frame, 2 per shape.
+#endif // RENDER_COLOR_COUNT
+
+#define OPTIMIZE_PASSES     8            // Maximum number of 2-opt passes made by xyRendererOptimize.
+
+// Datatypes ------------------------------------------------------------------------------------------------------------------
+
+// Render Stack
+// - Set of shapes making up a frame.
+// - The renderer keeps 3 of these, the back stack is modified by the application, the commit stack holds the most recent
+//   commit, and the front stack is the one being rendered. Commits copy the back stack into the commit stack, the renderer
+//   swaps the commit and front stacks at the start of a frame. Neither side ever reads a stack the other may be writing.
+// - Shapes are slots of a pool. The render order only holds the slots in use, slots of removed shapes are left out of it
+//   and are never read. See the free slots of the back stack.
+struct renderStack
+{
+    xyShape_t shapes[RENDER_STACK_SIZE];    // Slots of the shapes to be rendered.
+    uint16_t  order[RENDER_STACK_SIZE];     // Indices of the shapes, in the order to render them.
+    bool      reversed[RENDER_STACK_SIZE];  // Indicates whether to trace each shape in reverse (indexed by shape).
+    uint16_t  count;                        // Number of shapes in the render order.
+    uint16_t  top;                          // Index of the first slot never used, every slot past it is free.
+    xyCoord_t stepMax;                      // Maximum step of lit moves, 0 to disable (see xyRendererSetInterpolation).
+    uint16_t  stepDwellUs;                  // Dwell of a step of the maximum length.
+};
+
+// Typedef for brevity.
+typedef struct renderStack renderStack_t;
+
+// Renderer Statistics
+// - Internal counters of xyRendererGetStats, only written by core 1 and only once per commit.
+// - Frames are counted by the output engine, so the totals only cover the streams that have been replaced. The contribution
+//   of the playing stream is added when read, from the number of frames played since it was picked up.
+struct rendererStats
+{
+    uint32_t commits;                    // Number of commits compiled.
+    uint32_t periodMinTicks;             // Shortest stream compiled.
+    uint32_t periodMaxTicks;             // Longest stream compiled.
+    uint64_t periodTicks;                // Total time of the frames of replaced streams.
+    uint64_t litTicks;                   // Total lit time of the frames of replaced streams.
+    uint64_t colorTicks;                 // Total color time of the frames of replaced streams.
+    uint64_t points;                     // Total samples of the frames of replaced streams.
+    uint32_t frameStart;                 // Frame count of the engine when the playing stream was picked up.
+    uint32_t streamTicks;                // Duration of the playing stream.
+    uint32_t streamLitTicks;             // Lit time of the playing stream.
+    uint32_t streamColorTicks;           // Color time of the playing stream.
+    uint16_t streamPoints;               // Samples of the playing stream.
+    uint16_t shapeMaxIndex;              // Most expensive shape of the playing stream.
+    uint32_t shapeMaxTicks;              // Time spent on the most expensive shape.
+};
+
+// Typedef for brevity.
+typedef struct rendererStats rendererStats_t;
 
 // Global Memory --------------------------------------------------------------------------------------------------------------
 
 volatile bool      rendererActive  = false;                    // Indicates whether or not to run the renderer.
 
-volatile xyShape_t renderStack[RENDER_STACK_SIZE];             // Stack of shapes to be rendered
-volatile uint16_t  stackTop        = 0;                        // Index of the top of the stack (next empty index)
+renderStack_t      renderStacks[3];                            // Back, commit, and front stacks (in no particular order).
+renderStack_t*     backStack       = &renderStacks[0];         // Stack being modified by the application (core 0 only).
+renderStack_t*     commitStack     = &renderStacks[1];         // Most recently committed stack (guarded by the lock).
+renderStack_t*     frontStack      = &renderStacks[2];         // Stack being rendered (core 1 only).
+volatile bool      commitPending   = false;                    // Indicates the commit stack has yet to be picked up.
+spin_lock_t*       stackLock       = NULL;                     // Lock guarding the commit stack.
+
+uint16_t           freeSlots[RENDER_STACK_SIZE];               // Slots of removed shapes of the back stack, reused first.
+uint16_t           freeCount       = 0;                        // Number of elements in the free slot array.
+uint16_t           slotPositions[RENDER_STACK_SIZE];           // Position of each slot of the back stack in its render order, UINT16_MAX if free.
+
+xySample_t         streamSamples[2][RENDER_SAMPLE_COUNT];     // Sample buffers of the frame streams
+xyRgb_t            streamColors[2][RENDER_COLOR_COUNT];       // Color buffers of the frame streams
+
+xyStream_t         streams[2] =                               // Frame streams, one is played while the other is generated
+{
+    {
+        .samples        = streamSamples[0],
+        .sampleCapacity = RENDER_SAMPLE_COUNT,
+        .colors         = streamColors[0],
+        .colorCapacity  = RENDER_COLOR_COUNT
+    },
+    {
+        .samples        = streamSamples[1],
+        .sampleCapacity = RENDER_SAMPLE_COUNT,
+        .colors         = streamColors[1],
+        .colorCapacity  = RENDER_COLOR_COUNT
+    }
+};
 
-uint16_t           stackShapeIndex = 0;                        // Index of the current shape being rendered (index in stack)
-uint16_t           stackPointIndex = 0;                        // Index of the current point being rendered (index in shape)
+rendererStats_t    stats;                                      // Statistics of the renderer (core 1 only).
+volatile uint32_t  statsSequence   = 0;                        // Incremented before and after each update of the statistics.
 
 // Function Prototypes --------------------------------------------------------------------------------------------------------
 
+// Renderer Lock Init
+// - Call to claim the stack lock, if not already claimed.
+void rendererLockInit();
+
+// Shape Rendered
+// - Call to check whether a shape produces any output.
+bool rendererShapeRendered(xyShape_t* shape);
+
+// Shape Start / End
+// - Call to get the position at which the beam turns on / off for a shape, accounting for the direction it is traced in.
+xyPoint_t rendererShapeStart(xyShape_t* shape, bool reversed);
+xyPoint_t rendererShapeEnd(xyShape_t* shape, bool reversed);
+
+// Move Cost
+// - Call to get the time spent between tracing two shapes, in us, each traced in the specified direction.
+// - Mirrors xyStreamShape. A shape beginning where the previous ends continues its stroke, costing nothing if both share
+//   a color, or a color change otherwise. Any other move is blanked, costing a color change to turn the beam off, then the
+//   longer of the move and the color change turning it back on.
+uint32_t rendererMoveCost(xyShape_t* from, bool fromReversed, xyShape_t* to, bool toReversed);
+
+// Allocate Shape
+// - Call to claim a slot of the back stack, appending it to the render order.
+// - Slots of removed shapes are reused first, unless consecutive slots are needed (characters of a string), in which case
+//   the slot is taken from the top of the stack.
+// - Returns NULL if the stack is full.
+xyShape_t* rendererShapeAllocate(bool consecutive);
+
+// Render Shape / Char
+// - Implementation of xyRenderShape and xyRenderChar, see rendererShapeAllocate for consecutive.
+volatile xyShape_t* rendererRenderShape(volatile xyPoint_t* points, uint16_t pointCount, xyCoord_t positionX, xyCoord_t positionY, bool visible, bool consecutive);
+volatile xyShape_t* rendererRenderChar(char data, xyCoord_t xPosition, xyCoord_t yPosition, bool consecutive);
+
+// String Layout
+// - Call to place the next character of a string within the specified bounds, wrapping lines as needed. Newlines are skipped
+//   past, the string is left at the character to place.
+// - Returns false once the end of the string is reached, or the character does not fit.
+bool rendererStringNext(char** data, xyCoord_t* positionX, xyCoord_t* positionY, xyCoord_t lowerBoundX, xyCoord_t lowerBoundY, xyCoord_t upperBoundX);
+
+// String Reverse
+// - Call to reverse a run of baked points in place, along with the breaks within it. The points are traced in the opposite
+//   order, the same moves being blanked.
+// - The breaks within the run are those in the range [breakStart, breakEnd), each greater than the first point.
+void rendererStringReverse(volatile xyPoint_t* points, uint16_t* breaks, uint16_t pointStart, uint16_t pointEnd, uint16_t breakStart, uint16_t breakEnd);
+
+// Renderer Compile
+// - Call to compile a render stack into a stream for the output engine.
+// - The cursor position is the best guess of where the stream begins, typically the end of the previous stream.
+// - The index and duration of the most expensive shape are written to the specified variables.
+void rendererCompile(xyStream_t* stream, renderStack_t* stack, xyCoord_t cursorX, xyCoord_t cursorY, uint16_t* shapeMaxIndex, uint32_t* shapeMaxTicks);
+
+// Statistics Reset / Update
+// - Call to reset the statistics, before starting the renderer.
+// - Call to update the statistics once a stream has been picked up by the output engine.
+void rendererStatsReset();
+void rendererStatsUpdate(xyStream_t* stream, uint16_t shapeMaxIndex, uint32_t shapeMaxTicks);
+
 // Renderer Entrypoint
-// - Infinite loop for rendering.
+// - Loop for generating frames.
 // - Entrypoint for Pico core #1.
-// - Does not return.
+// - Each iteration picks up the latest commit, compiles the front stack into a stream and submits it to the output engine,
+//   then sleeps until the next commit. The engine replays the stream every frame in the meantime, the output timing is
+//   entirely handled by it.
+// - Returns once the renderer is stopped.
 void rendererEntrypoint();
 
 // Function Definitions -------------------------------------------------------------------------------------------------------
 
 volatile xyShape_t* xyRenderShape(volatile xyPoint_t* points, uint16_t pointCount, xyCoord_t positionX, xyCoord_t positionY, bool visible)
 {
-    // Check for full stack
-    if(stackTop >= RENDER_STACK_SIZE) return NULL;
+    return rendererRenderShape(points, pointCount, positionX, positionY, visible, false);
+}
 
-    // Write shape to stack and update top
-    renderStack[stackTop].points     = points;
-    renderStack[stackTop].pointCount = pointCount;
-    renderStack[stackTop].positionX  = positionX;
-    renderStack[stackTop].positionY  = positionY;
-    renderStack[stackTop].colorRed   = 255;
-    renderStack[stackTop].colorGreen = 255;
-    renderStack[stackTop].colorBlue  = 255;
-    renderStack[stackTop].visible    = visible;
-    ++stackTop;
+volatile xyShape_t* xyRenderPacked(const uint8_t* frame, xyCoord_t positionX, xyCoord_t positionY, bool visible)
+{
+    volatile xyShape_t* shape = xyRenderShape(NULL, xyPackedCount(frame), positionX, positionY, visible);
+    if(shape == NULL) return NULL;
 
-    // Return a reference to the new shape
-    return &(renderStack[stackTop - 1]);
+    shape->packed = frame;
+    return shape;
 }
 
 volatile xyShape_t* xyRenderChar(char data, xyCoord_t xPosition, xyCoord_t yPosition)
 {
-    // Fetch the character shape from the ASCII table, render, and return the reference
-    return xyRenderShape(xyShape16x16Ascii[data], xyShapeSize16x16Ascii[data], xPosition, yPosition, true);
+    return rendererRenderChar(data, xPosition, yPosition, false);
 }
 
 xyString_t xyRenderString(char* data, xyCoord_t lowerBoundX, xyCoord_t lowerBoundY, xyCoord_t upperBoundX, xyCoord_t upperBoundY)
@@ -80,37 +221,27 @@ xyString_t xyRenderString(char* data, xyCoord_t lowerBoundX, xyCoord_t lowerBoun
     xyString_t string =
     {
         .characters     = NULL,
-        .characterCount = 0
+        .characterCount = 0,
+        .lowerBoundX    = lowerBoundX,
+        .lowerBoundY    = lowerBoundY,
+        .upperBoundX    = upperBoundX,
+        .upperBoundY    = upperBoundY
     };
 
     xyCoord_t positionX = lowerBoundX;
     xyCoord_t positionY = upperBoundY - 0x10;
 
     int index = 0;
-    while(*data != '\0')
+    while(rendererStringNext(&data, &positionX, &positionY, lowerBoundX, lowerBoundY, upperBoundX))
     {
-        if(positionX + 0x0C >= upperBoundX || *data == '\n')
-        {
-            if(positionY - 0x14 < lowerBoundY) break;
-
-            positionX = lowerBoundX;
-            positionY -= 0x14;
-
-            if(*data == '\n')
-            {
-                ++data;
-                continue;
-            }
-        }
-
         if(index == 0)
         {
-            string.characters = xyRenderChar(*data, positionX, positionY);
+            string.characters = rendererRenderChar(*data, positionX, positionY, true);
             if(string.characters == NULL) break;
         }
         else
         {
-            if(xyRenderChar(*data, positionX, positionY) == NULL)
+            if(rendererRenderChar(*data, positionX, positionY, true) == NULL)
             {
                 break;
             }
@@ -121,12 +252,253 @@ xyString_t xyRenderString(char* data, xyCoord_t lowerBoundX, xyCoord_t lowerBoun
         ++index;
     }
 
+    string.characterCount = index;
     return string;
 }
 
+volatile xyShape_t* xyRenderStringBaked(char* data, xyCoord_t lowerBoundX, xyCoord_t lowerBoundY, xyCoord_t upperBoundX, xyCoord_t upperBoundY, volatile xyPoint_t* points, uint16_t pointCapacity, uint16_t* breaks, uint16_t breakCapacity)
+{
+    // Points are relative to the first character
+    xyCoord_t originX   = lowerBoundX;
+    xyCoord_t originY   = upperBoundY - 0x10;
+    xyCoord_t positionX = originX;
+    xyCoord_t positionY = originY;
+
+    uint16_t pointCount = 0;
+    uint16_t breakCount = 0;
+
+    // Current row of characters
+    xyCoord_t rowY        = originY;
+    uint16_t  rowPoint    = 0;
+    uint16_t  rowBreak    = 0;
+    bool      rowReversed = false;
+
+    while(rendererStringNext(&data, &positionX, &positionY, lowerBoundX, lowerBoundY, upperBoundX))
+    {
+        uint8_t  character = *data;
+        uint16_t size      = character < 128 ? xyShapeSize16x16Ascii[character] : 0;
+
+        if(size != 0)
+        {
+            const uint16_t* glyphBreaks = xyShapeBreaks16x16Ascii[character];
+            uint16_t        strokes     = xyShapeBreakCount16x16Ascii[character];
+
+            // Stop at a full buffer, the move to the character is blanked along with its own strokes
+            if(pointCount + size > pointCapacity || breakCount + strokes + (pointCount != 0 ? 1 : 0) > breakCapacity) break;
+
+            // Rows alternate direction, so that each begins near where the previous one ends
+            if(pointCount == 0 || positionY != rowY)
+            {
+                if(rowReversed) rendererStringReverse(points, breaks, rowPoint, pointCount, rowBreak, breakCount);
+
+                rowReversed = pointCount != 0 && !rowReversed;
+                rowPoint    = pointCount;
+                rowY        = positionY;
+            }
+
+            if(pointCount != 0) breaks[breakCount++] = pointCount;
+            if(pointCount == rowPoint) rowBreak = breakCount;
+            for(uint16_t index = 0; index < strokes; ++index) breaks[breakCount++] = pointCount + glyphBreaks[index];
+            xyShapeAppend(xyShape16x16Ascii[character], points, size, pointCount, positionX - originX, positionY - originY);
+
+            pointCount += size;
+        }
+
+        positionX += 0x10;
+        ++data;
+    }
+
+    if(rowReversed) rendererStringReverse(points, breaks, rowPoint, pointCount, rowBreak, breakCount);
+
+    volatile xyShape_t* shape = xyRenderShape(points, pointCount, originX, originY, true);
+    if(shape == NULL) return NULL;
+
+    shape->breaks     = breaks;
+    shape->breakCount = breakCount;
+    return shape;
+}
+
+void xyRendererRemove(volatile xyShape_t* shape)
+{
+    // Ignore shapes that are not in the stack
+    if(shape < backStack->shapes || shape >= backStack->shapes + backStack->top) return;
+
+    uint16_t index    = shape - backStack->shapes;
+    uint16_t position = slotPositions[index];
+    if(position == UINT16_MAX) return;
+
+    // Fill the gap in the render order with its last shape
+    uint16_t last = backStack->order[--backStack->count];
+    backStack->order[position] = last;
+    slotPositions[last]        = position;
+    slotPositions[index]       = UINT16_MAX;
+
+    freeSlots[freeCount++] = index;
+}
+
 void xyRendererClear()
 {
-    stackTop = 0;
+    backStack->count = 0;
+    backStack->top   = 0;
+    freeCount        = 0;
+}
+
+void xyRendererCommit()
+{
+    rendererLockInit();
+
+    spin_lock_unsafe_blocking(stackLock);
+
+    // Copy the shapes of the back stack, overwriting any commit the renderer has yet to pick up. Free slots are skipped, as
+    // are shapes that produce no output (hidden or empty), so the renderer only walks the shapes it draws.
+    uint16_t count = 0;
+    for(uint16_t position = 0; position < backStack->count; ++position)
+    {
+        uint16_t index = backStack->order[position];
+        if(!rendererShapeRendered(&backStack->shapes[index])) continue;
+
+        commitStack->shapes[index]   = backStack->shapes[index];
+        commitStack->order[count++]  = index;
+        commitStack->reversed[index] = backStack->reversed[index];
+    }
+    commitStack->count       = count;
+    commitStack->top         = backStack->top;
+    commitStack->stepMax     = backStack->stepMax;
+    commitStack->stepDwellUs = backStack->stepDwellUs;
+    commitPending = true;
+
+    spin_unlock_unsafe(stackLock);
+
+    // Wake the renderer
+    __sev();
+}
+
+void xyRendererOptimize()
+{
+    renderStack_t* stack = backStack;
+
+    // Gather rendered shapes at the front of the order, the rest are skipped by the renderer anyways. Free slots are left out.
+    uint16_t count  = 0;
+    bool     packed = false;
+    for(uint16_t index = 0; index < stack->top; ++index)
+    {
+        if(slotPositions[index] == UINT16_MAX) continue;
+
+        if(rendererShapeRendered(&stack->shapes[index])) stack->order[count++] = index;
+        if(stack->shapes[index].packed != NULL) packed = true;
+        stack->reversed[index] = false;
+    }
+    uint16_t hiddenIndex = count;
+    for(uint16_t index = 0; index < stack->top; ++index)
+    {
+        if(slotPositions[index] == UINT16_MAX) continue;
+
+        if(!rendererShapeRendered(&stack->shapes[index])) stack->order[hiddenIndex++] = index;
+    }
+
+    // Positions are updated again once the rendered shapes are reordered
+    for(uint16_t position = 0; position < stack->count; ++position) slotPositions[stack->order[position]] = position;
+
+    if(count < 2) return;
+
+    // Greedy pass
+    // - Starting from the first shape, repeatedly pick the shape (and direction) closest to the end of the previous one.
+    for(uint16_t position = 1; position < count; ++position)
+    {
+        uint16_t   previous      = stack->order[position - 1];
+        xyShape_t* previousShape = &stack->shapes[previous];
+
+        uint16_t bestPosition = position;
+        bool     bestReversed = false;
+        uint32_t bestCost     = UINT32_MAX;
+
+        for(uint16_t candidate = position; candidate < count; ++candidate)
+        {
+            xyShape_t* shape = &stack->shapes[stack->order[candidate]];
+
+            uint32_t cost = rendererMoveCost(previousShape, stack->reversed[previous], shape, false);
+            if(cost < bestCost)
+            {
+                bestCost     = cost;
+                bestPosition = candidate;
+                bestReversed = false;
+            }
+
+            cost = rendererMoveCost(previousShape, stack->reversed[previous], shape, true);
+            if(cost < bestCost)
+            {
+                bestCost     = cost;
+                bestPosition = candidate;
+                bestReversed = true;
+            }
+        }
+
+        uint16_t best = stack->order[bestPosition];
+        stack->order[bestPosition] = stack->order[position];
+        stack->order[position]     = best;
+        stack->reversed[best]      = bestReversed;
+    }
+
+    // 2-opt passes
+    // - The frame is a loop, the tour wraps from the last shape to the first. Reversing a section of the tour also reverses
+    //   the direction of each shape in it, so only the 2 moves at the boundaries of the section change cost.
+    // - Packed shapes cannot be reversed, so the above does not hold for scenes containing them.
+    for(uint16_t pass = 0; pass < OPTIMIZE_PASSES && !packed; ++pass)
+    {
+        bool improved = false;
+
+        for(uint16_t first = 0; first < count - 1; ++first)
+        {
+            for(uint16_t last = first + 1; last < count; ++last)
+            {
+                // Reversing the entire tour changes nothing
+                if(first == 0 && last == count - 1) continue;
+
+                uint16_t previous = stack->order[first == 0 ? count - 1 : first - 1];
+                uint16_t next     = stack->order[last == count - 1 ? 0 : last + 1];
+                uint16_t head     = stack->order[first];
+                uint16_t tail     = stack->order[last];
+
+                xyShape_t* previousShape = &stack->shapes[previous];
+                xyShape_t* nextShape     = &stack->shapes[next];
+                xyShape_t* headShape     = &stack->shapes[head];
+                xyShape_t* tailShape     = &stack->shapes[tail];
+
+                // Once reversed, the tail follows the previous shape and the head precedes the next
+                uint32_t costBefore =
+                    rendererMoveCost(previousShape, stack->reversed[previous], headShape, stack->reversed[head]) +
+                    rendererMoveCost(tailShape, stack->reversed[tail], nextShape, stack->reversed[next]);
+                uint32_t costAfter =
+                    rendererMoveCost(previousShape, stack->reversed[previous], tailShape, !stack->reversed[tail]) +
+                    rendererMoveCost(headShape, !stack->reversed[head], nextShape, stack->reversed[next]);
+                if(costAfter >= costBefore) continue;
+
+                // Reverse section
+                for(uint16_t lower = first, upper = last; lower < upper; ++lower, --upper)
+                {
+                    uint16_t shape = stack->order[lower];
+                    stack->order[lower] = stack->order[upper];
+                    stack->order[upper] = shape;
+                }
+                for(uint16_t position = first; position <= last; ++position)
+                {
+                    stack->reversed[stack->order[position]] = !stack->reversed[stack->order[position]];
+                }
+
+                improved = true;
+            }
+        }
+
+        if(!improved) break;
+    }
+
+    for(uint16_t position = 0; position < count; ++position) slotPositions[stack->order[position]] = position;
+}
+
+void xyRendererSetInterpolation(xyCoord_t stepMax, uint16_t stepDwellUs)
+{
+    backStack->stepMax     = stepMax;
+    backStack->stepDwellUs = stepDwellUs;
 }
 
 void xyRendererStart()
@@ -136,6 +508,11 @@ void xyRendererStart()
 
     // Set flag
     rendererActive = true;
+    rendererLockInit();
+    rendererStatsReset();
+
+    // Start output engine
+    xyStreamStart();
 
     // Start core 1
     multicore_launch_core1(rendererEntrypoint);
@@ -146,207 +523,389 @@ void xyRendererStop()
     // Set flag to stop core 1
     rendererActive = false;
 
-    // Delay long enough to cross the entire screen (waits until renderer is done moving)
-    uint16_t delayUs = xyGetMoveDelayUs(0, 0, xyScreenWidth(), xyScreenHeight());
-    sleep_us(delayUs);
+    // Stop output engine (waits until the current frame is done), wake core 1 if waiting on it
+    xyStreamStop();
+    __sev();
 
     // Reset cursor
     xyCursorMove(0, 0);
     xyCursorColor(0, 0, 0);
 }
 
-void rendererEntrypoint()
+xyRendererStats_t xyRendererGetStats()
 {
-    while(rendererActive)
-    {
-        #ifdef RENDERER_DEBUG
-        printf("[libxy renderer] Shape Index: %3i, Point Index: %3i, ", stackShapeIndex, stackPointIndex);
-        #endif // RENDERER_DEBUG
+    rendererStats_t snapshot;
+    uint32_t        frames;
+    uint32_t        sequence;
 
-        // Check for empty stack
-        if(stackTop == 0)
-        {
-            xyCursorColor(0, 0, 0);
-            continue;
-        }
-
-        bool shapeValid = renderStack[stackShapeIndex].pointCount != 0 && renderStack[stackShapeIndex].points != NULL & renderStack[stackShapeIndex].visible;
-
-        // Render shapes
-        if(shapeValid)
-        {
-            xyCoord_t x = renderStack[stackShapeIndex].points[stackPointIndex].x + renderStack[stackShapeIndex].positionX;
-            xyCoord_t y = renderStack[stackShapeIndex].points[stackPointIndex].y + renderStack[stackShapeIndex].positionY;
+    // Retry until a copy is made without an update in progress or in between
+    do
+    {
+        sequence = statsSequence;
+        __dmb();
+        snapshot = stats;
+        frames   = xyStreamFrames();
+        __dmb();
+    }
+    while((sequence & 1) || sequence != statsSequence);
 
-            uint16_t delayUs = xyGetCursorDelayUs(x, y);
+    // Add the frames of the playing stream
+    uint32_t played = frames - snapshot.frameStart;
+    uint64_t periodTicks = snapshot.periodTicks + (uint64_t)played * snapshot.streamTicks;
+    uint64_t litTicks    = snapshot.litTicks    + (uint64_t)played * snapshot.streamLitTicks;
+    uint64_t colorTicks  = snapshot.colorTicks  + (uint64_t)played * snapshot.streamColorTicks;
 
-            #ifdef RENDERER_DEBUG
-            printf("Current Position: (%3i, %3i), Next Position: (%3i, %3i) => Delay: %4i\r\n  ", xyCursorX(), xyCursorY(), x, y, delayUs);
-            #endif // RENDERER_DEBUG
+    xyRendererStats_t result =
+    {
+        .frames        = frames,
+        .commits       = snapshot.commits,
+        .periodMinUs   = snapshot.commits != 0 ? snapshot.periodMinTicks / XY_STREAM_TICKS_PER_US : 0,
+        .periodAvgUs   = frames != 0 ? periodTicks / frames / XY_STREAM_TICKS_PER_US : 0,
+        .periodMaxUs   = snapshot.periodMaxTicks / XY_STREAM_TICKS_PER_US,
+        .points        = snapshot.points + (uint64_t)played * snapshot.streamPoints,
+        .litUs         = litTicks / XY_STREAM_TICKS_PER_US,
+        .blankUs       = (periodTicks - litTicks - colorTicks) / XY_STREAM_TICKS_PER_US,
+        .colorUs       = colorTicks / XY_STREAM_TICKS_PER_US,
+        .shapeMaxIndex = snapshot.shapeMaxIndex,
+        .shapeMaxUs    = snapshot.shapeMaxTicks / XY_STREAM_TICKS_PER_US
+    };
 
-            #ifdef RENDERER_DEBUG
-            printf("Move()  =>  ");
-            #endif // RENDERER_DEBUG
+    return result;
+}
 
-            xyCursorMove(x, y);
+void xyStringUpdate(xyString_t* string, char* data)
+{
+    xyCoord_t positionX = string->lowerBoundX;
+    xyCoord_t positionY = string->upperBoundY - 0x10;
 
-            #ifdef RENDERER_DEBUG
-            printf("Delay()  =>  ");
-            #endif // RENDERER_DEBUG
+    uint16_t index = 0;
+    while(rendererStringNext(&data, &positionX, &positionY, string->lowerBoundX, string->lowerBoundY, string->upperBoundX))
+    {
+        // Characters outside of the ASCII table are the null character (empty), whether rewritten or rendered
+        uint8_t character = *data;
+        if(character >= 128) character = 0;
 
-            sleep_us(delayUs);
+        if(index < string->characterCount)
+        {
+            volatile xyShape_t* shape = &string->characters[index];
 
-            if(stackPointIndex == renderStack[stackShapeIndex].pointCount - 1)
+            // Rewrite changed characters only, glyphs sharing a point array look the same
+            if(shape->points != xyShape16x16Ascii[character])
             {
-                #ifdef RENDERER_DEBUG
-                printf("Beam Off()  =>  ");
-                #endif // RENDERER_DEBUG
-
-                xyCursorColor(0, 0, 0);
+                shape->points     = xyShape16x16Ascii[character];
+                shape->pointCount = xyShapeSize16x16Ascii[character];
+                shape->breaks     = xyShapeBreaks16x16Ascii[character];
+                shape->breakCount = xyShapeBreakCount16x16Ascii[character];
             }
 
-            if(stackPointIndex == 0)
+            if(shape->positionX != positionX || shape->positionY != positionY)
             {
-                #ifdef RENDERER_DEBUG
-                printf("Beam On()  =>  ");
-                #endif // RENDERER_DEBUG
-
-                xyCursorColor(renderStack[stackShapeIndex].colorRed, renderStack[stackShapeIndex].colorGreen, renderStack[stackShapeIndex].colorBlue);
+                shape->positionX = positionX;
+                shape->positionY = positionY;
             }
         }
         else
         {
-            #ifdef RENDERER_DEBUG
-            printf("Shape invalid.");
-            #endif // RENDERER_DEBUG
-
-            xyCursorColor(0, 0, 0);
-        }
+            // Extend the string, only possible while the slot after it is free
+            if(string->characters != NULL && string->characters + string->characterCount != &backStack->shapes[backStack->top]) break;
 
-        // Update indices
-        ++stackPointIndex;
-        // Start new shape at end of current
-        if(stackPointIndex >= renderStack[stackShapeIndex].pointCount)
-        {
-            stackPointIndex = 0;
-            ++stackShapeIndex;
+            volatile xyShape_t* shape = rendererRenderChar(character, positionX, positionY, true);
+            if(shape == NULL) break;
 
-            // Keep shape index inside of stack
-            if(stackShapeIndex >= stackTop)
-            {
-                stackShapeIndex = 0;
-            }
+            if(string->characters == NULL) string->characters = shape;
+            ++string->characterCount;
         }
 
-        #ifdef RENDERER_DEBUG
-        printf("\r\n");
-        #endif // RENDERER_DEBUG
+        positionX += 0x10;
+        ++data;
+        ++index;
     }
-}
 
-void xyShapeCopy(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY)
-{
-    // Copy point values from source
-    for(uint16_t index = 0; index < sourceSize; ++index)
+    // Empty the remaining characters, keeping their slots
+    for(; index < string->characterCount; ++index)
     {
-        destination[index].x = source[index].x + originX;
-        destination[index].y = source[index].y + originY;
+        string->characters[index].points     = NULL;
+        string->characters[index].pointCount = 0;
+        string->characters[index].breaks     = NULL;
+        string->characters[index].breakCount = 0;
     }
 }
 
-void xyShapeAppend(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, uint16_t destinationIndex, xyCoord_t originX, xyCoord_t originY)
+void xyStringBakedSize(char* data, uint16_t* pointCount, uint16_t* breakCount)
 {
-    // Copy point values from source starting from destination index
-    for(uint16_t index = 0; index < sourceSize; ++index)
+    *pointCount = 0;
+    *breakCount = 0;
+
+    for(; *data != '\0'; ++data)
     {
-        destination[index + destinationIndex].x = source[index].x + originX;
-        destination[index + destinationIndex].y = source[index].y + originY;
+        uint8_t character = *data;
+        if(character == '\n' || character >= 128 || xyShapeSize16x16Ascii[character] == 0) continue;
+
+        // Every character but the first is moved to with the beam off
+        if(*pointCount != 0) ++*breakCount;
+        *pointCount += xyShapeSize16x16Ascii[character];
+        *breakCount += xyShapeBreakCount16x16Ascii[character];
     }
 }
 
-void xyShapeTranslate(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, xyCoord_t offsetX, xyCoord_t offsetY, float scalarX, float scalarY, float theta)
+void rendererEntrypoint()
 {
-    for(uint16_t index = 0; index < sourceSize; ++index)
+    uint8_t streamIndex = 0;
+
+    while(rendererActive)
     {
-        // Offset
-        xyCoordLong_t x = (xyCoordLong_t)source[index].x + offsetX - originX;
-        xyCoordLong_t y = (xyCoordLong_t)source[index].y + offsetY - originY;
+        // Pick up the latest commit
+        spin_lock_unsafe_blocking(stackLock);
+        if(commitPending)
+        {
+            renderStack_t* stack = frontStack;
+            frontStack    = commitStack;
+            commitStack   = stack;
+            commitPending = false;
+        }
+        spin_unlock_unsafe(stackLock);
+
+        // Compile the frame, starting from where the previous one ends
+        xyStream_t* stream = &streams[streamIndex];
+        uint16_t    shapeMaxIndex;
+        uint32_t    shapeMaxTicks;
+        rendererCompile(stream, frontStack, streams[streamIndex ^ 1].cursorX, streams[streamIndex ^ 1].cursorY, &shapeMaxIndex, &shapeMaxTicks);
+
+        #ifdef RENDERER_DEBUG
+        printf("[libxy renderer] Shapes: %3i, Samples: %4i, Colors: %3i\r\n", frontStack->count, stream->sampleCount, stream->colorCount);
+        #endif // RENDERER_DEBUG
+
+        // Submit frame and wait for it to be picked up. The other stream is no longer in use once the engine has also applied
+        // the colors of its tail, still in the FIFO when the DMA switches over (see xyStreamPending).
+        xyStreamSubmit(stream);
+        while(xyStreamPending() && rendererActive) __wfe();
 
-        // Scale
-        x *= scalarX;
-        y *= scalarY;
+        rendererStatsUpdate(stream, shapeMaxIndex, shapeMaxTicks);
 
-        // Rotation
-        xyCoordLong_t xPrime = round(x * cosf(theta) - y * sinf(theta));
-        xyCoordLong_t yPrime = round(x * sinf(theta) + y * cosf(theta));
+        streamIndex ^= 1;
 
-        destination[index].x = (xyCoord_t)(xPrime + originX);
-        destination[index].y = (xyCoord_t)(yPrime + originY);
+        // Sleep until the next commit, the engine replays the stream in the meantime
+        while(!commitPending && rendererActive) __wfe();
     }
 }
 
-void xyShapeRotate(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, float theta)
+void rendererCompile(xyStream_t* stream, renderStack_t* stack, xyCoord_t cursorX, xyCoord_t cursorY, uint16_t* shapeMaxIndex, uint32_t* shapeMaxTicks)
 {
-    for(uint16_t index = 0; index < sourceSize; ++index)
+    stream->stepMax        = stack->stepMax;
+    stream->stepDwellTicks = (uint32_t)stack->stepDwellUs * XY_STREAM_TICKS_PER_US;
+
+    // The stream is replayed in a loop, so it should begin where it ends. This is only known once it has been compiled, if the
+    // guess was wrong, compile again from the actual end. The second pass ends in the same place, unless the stream is full.
+    for(uint8_t pass = 0; pass < 2; ++pass)
     {
-        xyCoordLong_t x = (xyCoordLong_t)source[index].x - originX;
-        xyCoordLong_t y = (xyCoordLong_t)source[index].y - originY;
+        xyStreamBegin(stream, cursorX, cursorY);
+
+        *shapeMaxIndex = UINT16_MAX;
+        *shapeMaxTicks = 0;
+
+        // Render shapes
+        for(uint16_t position = 0; position < stack->count; ++position)
+        {
+            uint16_t index         = stack->order[position];
+            uint32_t durationTicks = stream->durationTicks;
 
-        xyCoordLong_t xPrime = round(x * cosf(theta) - y * sinf(theta));
-        xyCoordLong_t yPrime = round(x * sinf(theta) + y * cosf(theta));
+            // Stop at a full stream, remaining shapes are dropped
+            if(!xyStreamShape(stream, &stack->shapes[index], stack->reversed[index])) break;
 
-        destination[index].x = (xyCoord_t)(xPrime + originX);
-        destination[index].y = (xyCoord_t)(yPrime + originY);
+            if(stream->durationTicks - durationTicks > *shapeMaxTicks)
+            {
+                *shapeMaxIndex = index;
+                *shapeMaxTicks = stream->durationTicks - durationTicks;
+            }
+        }
+
+        // Beam off, space for this is kept by the last shape
+        xyStreamEnd(stream);
+
+        // Hold the cursor if nothing was rendered, the engine requires at least one sample
+        if(stream->sampleCount == 0) xyStreamMove(stream, stream->cursorX, stream->cursorY);
+
+        if(stream->cursorX == cursorX && stream->cursorY == cursorY) break;
+
+        cursorX = stream->cursorX;
+        cursorY = stream->cursorY;
     }
 }
 
-void xyShapeRotateInt(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, uint8_t theta)
+void rendererStatsReset()
 {
-    for(uint16_t index = 0; index < sourceSize; ++index)
+    stats = (rendererStats_t)
     {
-        xyCoordLong_t x = (xyCoordLong_t)source[index].x - originX;
-        xyCoordLong_t y = (xyCoordLong_t)source[index].y - originY;
+        .periodMinTicks = UINT32_MAX,
+        .shapeMaxIndex  = UINT16_MAX
+    };
+}
 
-        xyCoordLong_t xPrime = round((x * cos256x256Signed[theta] - y * sin256x256Signed[theta]) / 127.0f);
-        xyCoordLong_t yPrime = round((x * sin256x256Signed[theta] + y * cos256x256Signed[theta]) / 127.0f);
+void rendererStatsUpdate(xyStream_t* stream, uint16_t shapeMaxIndex, uint32_t shapeMaxTicks)
+{
+    uint32_t frames = xyStreamFrames();
+
+    ++statsSequence;
+    __dmb();
+
+    // Close out the replaced stream
+    uint32_t played = frames - stats.frameStart;
+    stats.periodTicks += (uint64_t)played * stats.streamTicks;
+    stats.litTicks    += (uint64_t)played * stats.streamLitTicks;
+    stats.colorTicks  += (uint64_t)played * stats.streamColorTicks;
+    stats.points      += (uint64_t)played * stats.streamPoints;
+    stats.frameStart   = frames;
+
+    // Start the new one
+    stats.streamTicks      = stream->durationTicks;
+    stats.streamLitTicks   = stream->litTicks;
+    stats.streamColorTicks = stream->colorTicks;
+    stats.streamPoints     = stream->sampleCount;
+    stats.shapeMaxIndex    = shapeMaxIndex;
+    stats.shapeMaxTicks    = shapeMaxTicks;
+
+    ++stats.commits;
+    if(stream->durationTicks < stats.periodMinTicks) stats.periodMinTicks = stream->durationTicks;
+    if(stream->durationTicks > stats.periodMaxTicks) stats.periodMaxTicks = stream->durationTicks;
+
+    __dmb();
+    ++statsSequence;
+}
 
-        destination[index].x = (xyCoord_t)(xPrime + originX);
-        destination[index].y = (xyCoord_t)(yPrime + originY);
-    }
+void rendererLockInit()
+{
+    if(stackLock == NULL) stackLock = spin_lock_init(spin_lock_claim_unused(true));
 }
 
-void xyShapeScale(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, float scalarX, float scalarY)
+bool rendererShapeRendered(xyShape_t* shape)
 {
-    for(uint16_t index = 0; index < sourceSize; ++index)
-    {
-        xyCoordLong_t x = (xyCoordLong_t)source[index].x - originX;
-        xyCoordLong_t y = (xyCoordLong_t)source[index].y - originY;
+    return shape->pointCount != 0 && (shape->points != NULL || shape->packed != NULL) && shape->visible;
+}
+
+xyPoint_t rendererShapeStart(xyShape_t* shape, bool reversed)
+{
+    // Packed shapes are never traced in reverse
+    if(shape->packed != NULL) reversed = false;
+
+    return xyShapeGetPoint(shape, reversed ? shape->pointCount - 1 : 0);
+}
+
+xyPoint_t rendererShapeEnd(xyShape_t* shape, bool reversed)
+{
+    if(shape->packed != NULL) reversed = false;
 
-        destination[index].x = round((xyCoord_t)(x * scalarX + originX));
-        destination[index].y = round((xyCoord_t)(y * scalarY + originY));
+    return xyShapeGetPoint(shape, reversed ? 0 : shape->pointCount - 1);
+}
+
+uint32_t rendererMoveCost(xyShape_t* from, bool fromReversed, xyShape_t* to, bool toReversed)
+{
+    xyPoint_t start   = rendererShapeEnd(from, fromReversed);
+    xyPoint_t end     = rendererShapeStart(to, toReversed);
+    uint32_t  colorUs = xyGetColorDelayUs();
+
+    if(start.x == end.x && start.y == end.y)
+    {
+        bool sameColor = from->colorRed == to->colorRed && from->colorGreen == to->colorGreen && from->colorBlue == to->colorBlue;
+        return sameColor ? 0 : colorUs;
     }
+
+    uint32_t moveUs = xyGetMoveDelayUs(start.x, start.y, end.x, end.y);
+    return colorUs + (moveUs > colorUs ? moveUs : colorUs);
 }
 
-void xyShapeMultiply(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, xyCoord_t scalarX, xyCoord_t scalarY)
+xyShape_t* rendererShapeAllocate(bool consecutive)
 {
-    for(uint16_t index = 0; index < sourceSize; ++index)
+    uint16_t index;
+    if(freeCount != 0 && !consecutive) index = freeSlots[--freeCount];
+    else if(backStack->top < RENDER_STACK_SIZE) index = backStack->top++;
+    else return NULL;
+
+    backStack->order[backStack->count] = index;
+    backStack->reversed[index]         = false;
+    slotPositions[index]               = backStack->count++;
+
+    return &backStack->shapes[index];
+}
+
+volatile xyShape_t* rendererRenderShape(volatile xyPoint_t* points, uint16_t pointCount, xyCoord_t positionX, xyCoord_t positionY, bool visible, bool consecutive)
+{
+    // Claim a slot, rendered last
+    xyShape_t* shape = rendererShapeAllocate(consecutive);
+    if(shape == NULL) return NULL;
+
+    // Write shape to the slot
+    shape->points      = points;
+    shape->pointCount  = pointCount;
+    shape->packed      = NULL;
+    shape->breaks      = NULL;
+    shape->breakCount  = 0;
+    shape->positionX   = positionX;
+    shape->positionY   = positionY;
+    shape->colorRed    = 255;
+    shape->colorGreen  = 255;
+    shape->colorBlue   = 255;
+    shape->visible     = visible;
+    shape->transformed = false;
+
+    // Return a reference to the new shape
+    return shape;
+}
+
+volatile xyShape_t* rendererRenderChar(char data, xyCoord_t xPosition, xyCoord_t yPosition, bool consecutive)
+{
+    // Characters outside of the ASCII table are rendered as the null character (empty)
+    uint8_t character = data;
+    if(character >= 128) character = 0;
+
+    // Fetch the character shape from the ASCII table, render, and return the reference
+    volatile xyShape_t* shape = rendererRenderShape(xyShape16x16Ascii[character], xyShapeSize16x16Ascii[character], xPosition,
+        yPosition, true, consecutive);
+    if(shape == NULL) return NULL;
+
+    // Strokes of the symbol
+    shape->breaks     = xyShapeBreaks16x16Ascii[character];
+    shape->breakCount = xyShapeBreakCount16x16Ascii[character];
+    return shape;
+}
+
+bool rendererStringNext(char** data, xyCoord_t* positionX, xyCoord_t* positionY, xyCoord_t lowerBoundX, xyCoord_t lowerBoundY, xyCoord_t upperBoundX)
+{
+    while(**data != '\0')
     {
-        xyCoordLong_t x = (xyCoordLong_t)source[index].x - originX;
-        xyCoordLong_t y = (xyCoordLong_t)source[index].y - originY;
+        if(*positionX + 0x0C >= upperBoundX || **data == '\n')
+        {
+            if(*positionY - 0x14 < lowerBoundY) return false;
+
+            *positionX = lowerBoundX;
+            *positionY -= 0x14;
+
+            if(**data == '\n')
+            {
+                ++*data;
+                continue;
+            }
+        }
 
-        destination[index].x = (xyCoord_t)(x * scalarX + originX);
-        destination[index].y = (xyCoord_t)(y * scalarY + originY);
+        return true;
     }
+
+    return false;
 }
 
-void xyShapeDivide(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, xyCoord_t divisorX, xyCoord_t divisorY)
+void rendererStringReverse(volatile xyPoint_t* points, uint16_t* breaks, uint16_t pointStart, uint16_t pointEnd, uint16_t breakStart, uint16_t breakEnd)
 {
-    for(uint16_t index = 0; index < sourceSize; ++index)
+    for(uint16_t lower = pointStart, upper = pointEnd - 1; lower < upper; ++lower, --upper)
     {
-        xyCoordLong_t x = (xyCoordLong_t)source[index].x - originX;
-        xyCoordLong_t y = (xyCoordLong_t)source[index].y - originY;
+        xyPoint_t point = points[lower];
+        points[lower] = points[upper];
+        points[upper] = point;
+    }
 
-        destination[index].x = (xyCoord_t)(x / divisorX + originX);
-        destination[index].y = (xyCoord_t)(y / divisorY + originY);
+    // The move into a point becomes the move out of its mirror, breaks are also mirrored to keep them in order
+    for(uint16_t lower = breakStart, upper = breakEnd - 1; lower <= upper && upper < breakEnd; ++lower, --upper)
+    {
+        uint16_t index = breaks[lower];
+        breaks[lower] = pointStart + pointEnd - breaks[upper];
+        breaks[upper] = pointStart + pointEnd - index;
     }
 }
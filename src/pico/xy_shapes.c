@@ -5,18 +5,19 @@
 
 struct xyPoint* const xyShapeNull = NULL;
 
-struct xyPoint xyShapePoint[XY_SHAPE_SIZE_POINT] = 
+struct xyPoint xyShapePoint[XY_SHAPE_SIZE_POINT] =
 {
     {0x00, 0x00}
 };
 
 // ASCII ----------------------------------------------------------------------------------------------------------------------
+// - Generated by 'tools/optimize_glyphs.c', see said file for details.
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X00 13
-struct xyPoint xyShape16x16Ascii0x00[XY_SHAPE_SIZE_16X16_ASCII_0X00] = 
+#define XY_SHAPE_SIZE_16X16_ASCII_0X00 11
+struct xyPoint xyShape16x16Ascii0x00[XY_SHAPE_SIZE_16X16_ASCII_0X00] =
 {
-    {0x00, 0x00}, {0x06, 0x08}, {0x0C, 0x10}, {0x06, 0x08}, {0x00, 0x00}, {0x00, 0x08}, {0x00, 0x10}, {0x06, 0x10},
-    {0x0C, 0x10}, {0x0C, 0x08}, {0x0C, 0x00}, {0x06, 0x00}, {0x00, 0x00}
+    {0x00, 0x00}, {0x06, 0x08}, {0x0C, 0x10}, {0x06, 0x10}, {0x00, 0x10}, {0x00, 0x08}, {0x00, 0x00}, {0x06, 0x00},
+    {0x0C, 0x00}, {0x0C, 0x08}, {0x0C, 0x10}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X20 0
@@ -25,77 +26,93 @@ struct xyPoint* const xyShape16x16Ascii0x20 = NULL;
 #define XY_SHAPE_SIZE_16X16_ASCII_0X21 9
 struct xyPoint xyShape16x16Ascii0x21[XY_SHAPE_SIZE_16X16_ASCII_0X21] =
 {
-    {0x05, 0x00}, {0x05, 0x02}, {0x07, 0x02}, {0x07, 0x00}, {0x08, 0x10}, {0x07, 0x04}, {0x05, 0x04}, {0x04, 0x10},
-    {0x08, 0x10}
+    {0x05, 0x04}, {0x07, 0x04}, {0x08, 0x10}, {0x04, 0x10}, {0x05, 0x04}, {0x05, 0x00}, {0x05, 0x02}, {0x07, 0x02},
+    {0x07, 0x00}
+};
+
+#define XY_SHAPE_BREAKS_16X16_ASCII_0X21 1
+const uint16_t xyShapeBreaks16x16Ascii0x21[XY_SHAPE_BREAKS_16X16_ASCII_0X21] =
+{
+    5
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X22 10
 struct xyPoint xyShape16x16Ascii0x22[XY_SHAPE_SIZE_16X16_ASCII_0X22] =
 {
-    {0x02, 0x0A}, {0x01, 0x10}, {0x05, 0x10}, {0x04, 0x0A}, {0x02, 0x0A}, {0x0A, 0x0A}, {0x08, 0x0A}, {0x07, 0x10},
-    {0x0B, 0x10}, {0x0A, 0x0A}
+    {0x07, 0x10}, {0x08, 0x0A}, {0x0A, 0x0A}, {0x0B, 0x10}, {0x07, 0x10}, {0x05, 0x10}, {0x01, 0x10}, {0x02, 0x0A},
+    {0x04, 0x0A}, {0x05, 0x10}
+};
+
+#define XY_SHAPE_BREAKS_16X16_ASCII_0X22 1
+const uint16_t xyShapeBreaks16x16Ascii0x22[XY_SHAPE_BREAKS_16X16_ASCII_0X22] =
+{
+    5
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X23 25
+#define XY_SHAPE_SIZE_16X16_ASCII_0X23 23
 struct xyPoint xyShape16x16Ascii0x23[XY_SHAPE_SIZE_16X16_ASCII_0X23] =
 {
-    {0x00, 0x00}, {0x01, 0x04}, {0x00, 0x04}, {0x01, 0x04}, {0x05, 0x04}, {0x09, 0x04}, {0x05, 0x04}, {0x01, 0x04},
-    {0x02, 0x08}, {0x03, 0x0C}, {0x00, 0x0C}, {0x03, 0x0C}, {0x04, 0x10}, {0x03, 0x0C}, {0x08, 0x0C}, {0x0B, 0x0C}, 
-    {0x0C, 0x10}, {0x0B, 0x0C}, {0x0C, 0x0C}, {0x0B, 0x0C}, {0x0A, 0x08}, {0x09, 0x04}, {0x0C, 0x04}, {0x09, 0x04}, 
-    {0x08, 0x00}
+    {0x08, 0x00}, {0x09, 0x04}, {0x05, 0x04}, {0x01, 0x04}, {0x00, 0x00}, {0x01, 0x04}, {0x00, 0x04}, {0x01, 0x04},
+    {0x02, 0x08}, {0x03, 0x0C}, {0x00, 0x0C}, {0x03, 0x0C}, {0x04, 0x10}, {0x03, 0x0C}, {0x08, 0x0C}, {0x0B, 0x0C},
+    {0x0C, 0x10}, {0x0B, 0x0C}, {0x0C, 0x0C}, {0x0B, 0x0C}, {0x0A, 0x08}, {0x09, 0x04}, {0x0C, 0x04}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X24 17
+#define XY_SHAPE_SIZE_16X16_ASCII_0X24 14
 struct xyPoint xyShape16x16Ascii0x24[XY_SHAPE_SIZE_16X16_ASCII_0X24] =
 {
-    {0x00, 0x05}, {0x04, 0x02}, {0x06, 0x02}, {0x06, 0x00}, {0x06, 0x02}, {0x06, 0x08}, {0x06, 0x10}, {0x06, 0x08}, 
-    {0x06, 0x02}, {0x08, 0x02}, {0x0C, 0x05}, {0x08, 0x08}, {0x04, 0x08}, {0x00, 0x0B}, {0x04, 0x0E}, {0x08, 0x0E},
-    {0x0C, 0x0B}
+    {0x00, 0x05}, {0x04, 0x02}, {0x06, 0x02}, {0x06, 0x00}, {0x06, 0x10}, {0x06, 0x02}, {0x08, 0x02}, {0x0C, 0x05},
+    {0x08, 0x08}, {0x04, 0x08}, {0x00, 0x0B}, {0x04, 0x0E}, {0x08, 0x0E}, {0x0C, 0x0B}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X25 13
 struct xyPoint xyShape16x16Ascii0x25[XY_SHAPE_SIZE_16X16_ASCII_0X25] =
 {
-    {0x00, 0x00}, {0x06, 0x08}, {0x0C, 0x10}, {0x03, 0x10}, {0x00, 0x0D}, {0x03, 0x0A}, {0x06, 0x0D}, {0x03, 0x10}, 
-    {0x09, 0x00}, {0x06, 0x03}, {0x09, 0x06}, {0x0C, 0x03}, {0x09, 0x00}
+    {0x03, 0x0A}, {0x00, 0x0D}, {0x03, 0x10}, {0x06, 0x0D}, {0x03, 0x0A}, {0x06, 0x03}, {0x09, 0x00}, {0x0C, 0x03},
+    {0x09, 0x06}, {0x06, 0x03}, {0x00, 0x00}, {0x06, 0x08}, {0x0C, 0x10}
+};
+
+#define XY_SHAPE_BREAKS_16X16_ASCII_0X25 2
+const uint16_t xyShapeBreaks16x16Ascii0x25[XY_SHAPE_BREAKS_16X16_ASCII_0X25] =
+{
+    5, 10
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X26 12
 struct xyPoint xyShape16x16Ascii0x26[XY_SHAPE_SIZE_16X16_ASCII_0X26] =
 {
-    {0x0C, 0x04}, {0x08, 0x00}, {0x04, 0x00}, {0x00, 0x04}, {0x00, 0x06}, {0x04, 0x0A}, {0x08, 0x0E}, {0x06, 0x10}, 
-    {0x04, 0x10}, {0x02, 0x0E}, {0x07, 0x07}, {0x0C, 0x00}
+    {0x0C, 0x00}, {0x07, 0x07}, {0x02, 0x0E}, {0x04, 0x10}, {0x06, 0x10}, {0x08, 0x0E}, {0x04, 0x0A}, {0x00, 0x06},
+    {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x00}, {0x0C, 0x04}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X27 5
 struct xyPoint xyShape16x16Ascii0x27[XY_SHAPE_SIZE_16X16_ASCII_0X27] =
 {
-    {0x05, 0x0A}, {0x04, 0x10}, {0x08, 0x10}, {0x07, 0x0A}, {0x05, 0x0A}
+    {0x04, 0x10}, {0x05, 0x0A}, {0x07, 0x0A}, {0x08, 0x10}, {0x04, 0x10}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X28 4
 struct xyPoint xyShape16x16Ascii0x28[XY_SHAPE_SIZE_16X16_ASCII_0X28] =
 {
-    {0x08, 0x10}, {0x04, 0x0C}, {0x04, 0x04}, {0x08, 0x00}
+    {0x08, 0x00}, {0x04, 0x04}, {0x04, 0x0C}, {0x08, 0x10}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X29 4
 struct xyPoint xyShape16x16Ascii0x29[XY_SHAPE_SIZE_16X16_ASCII_0X29] =
 {
-    {0x04, 0x10}, {0x08, 0x0C}, {0x08, 0x04}, {0x04, 0x00}
+    {0x04, 0x00}, {0x08, 0x04}, {0x08, 0x0C}, {0x04, 0x10}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X2A 9
 struct xyPoint xyShape16x16Ascii0x2A[XY_SHAPE_SIZE_16X16_ASCII_0X2A] =
 {
-    {0x04, 0x07}, {0x06, 0x0A}, {0x02, 0x0B}, {0x06, 0x0A}, {0x06, 0x0E}, {0x06, 0x0A}, {0x0A, 0x0B}, {0x06, 0x0A}, 
-    {0x08, 0x07}
+    {0x02, 0x0B}, {0x06, 0x0A}, {0x04, 0x07}, {0x06, 0x0A}, {0x06, 0x0E}, {0x06, 0x0A}, {0x08, 0x07}, {0x06, 0x0A},
+    {0x0A, 0x0B}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X2B 7
+#define XY_SHAPE_SIZE_16X16_ASCII_0X2B 6
 struct xyPoint xyShape16x16Ascii0x2B[XY_SHAPE_SIZE_16X16_ASCII_0X2B] =
 {
-    {0x00, 0x08}, {0x06, 0x08}, {0x06, 0x0D}, {0x06, 0x08}, {0x0C, 0x08}, {0x06, 0x08}, {0x06, 0x02}
+    {0x00, 0x08}, {0x06, 0x08}, {0x06, 0x0D}, {0x06, 0x02}, {0x06, 0x08}, {0x0C, 0x08}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X2C 6
@@ -122,29 +139,29 @@ struct xyPoint xyShape16x16Ascii0x2F[XY_SHAPE_SIZE_16X16_ASCII_0X2F] =
     {0x03, 0x00}, {0x06, 0x08}, {0x09, 0x10}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X30 14
+#define XY_SHAPE_SIZE_16X16_ASCII_0X30 13
 struct xyPoint xyShape16x16Ascii0x30[XY_SHAPE_SIZE_16X16_ASCII_0X30] =
 {
-    {0x04, 0x00}, {0x02, 0x02}, {0x06, 0x08}, {0x0A, 0x0E}, {0x06, 0x08}, {0x02, 0x02}, {0x00, 0x04}, {0x00, 0x0C},
-    {0x04, 0x10}, {0x08, 0x10}, {0x0A, 0x0E}, {0x0C, 0x0C}, {0x0C, 0x04}, {0x08, 0x00}
+    {0x08, 0x00}, {0x0C, 0x04}, {0x0C, 0x0C}, {0x0A, 0x0E}, {0x06, 0x08}, {0x02, 0x02}, {0x04, 0x00}, {0x02, 0x02},
+    {0x00, 0x04}, {0x00, 0x0C}, {0x04, 0x10}, {0x08, 0x10}, {0x0A, 0x0E}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X31 7
 struct xyPoint xyShape16x16Ascii0x31[XY_SHAPE_SIZE_16X16_ASCII_0X31] =
 {
-    {0x00, 0x00}, {0x06, 0x00}, {0x0C, 0x00}, {0x06, 0x00}, {0x06, 0x08}, {0x06, 0x10}, {0x00, 0x0A}
+    {0x00, 0x0A}, {0x06, 0x10}, {0x06, 0x08}, {0x06, 0x00}, {0x00, 0x00}, {0x06, 0x00}, {0x0C, 0x00}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X32 8
 struct xyPoint xyShape16x16Ascii0x32[XY_SHAPE_SIZE_16X16_ASCII_0X32] =
 {
-    {0x0C, 0x00}, {0x06, 0x00}, {0x00, 0x00}, {0x06, 0x06}, {0x0C, 0x0C}, {0x08, 0x10}, {0x04, 0x10}, {0x00, 0x0C}
+    {0x00, 0x0C}, {0x04, 0x10}, {0x08, 0x10}, {0x0C, 0x0C}, {0x06, 0x06}, {0x00, 0x00}, {0x06, 0x00}, {0x0C, 0x00}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X33 11
 struct xyPoint xyShape16x16Ascii0x33[XY_SHAPE_SIZE_16X16_ASCII_0X33] =
 {
-    {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x00}, {0x0C, 0x04}, {0x08, 0x08}, {0x04, 0x08}, {0x08, 0x08}, {0x0C, 0x0C}, 
+    {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x00}, {0x0C, 0x04}, {0x08, 0x08}, {0x04, 0x08}, {0x08, 0x08}, {0x0C, 0x0C},
     {0x08, 0x10}, {0x04, 0x10}, {0x00, 0x0C}
 };
 
@@ -157,21 +174,21 @@ struct xyPoint xyShape16x16Ascii0x34[XY_SHAPE_SIZE_16X16_ASCII_0X34] =
 #define XY_SHAPE_SIZE_16X16_ASCII_0X35 11
 struct xyPoint xyShape16x16Ascii0x35[XY_SHAPE_SIZE_16X16_ASCII_0X35] =
 {
-    {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x00}, {0x0C, 0x04}, {0x08, 0x08}, {0x04, 0x08}, {0x00, 0x08}, {0x00, 0x0C}, 
+    {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x00}, {0x0C, 0x04}, {0x08, 0x08}, {0x04, 0x08}, {0x00, 0x08}, {0x00, 0x0C},
     {0x00, 0x10}, {0x06, 0x10}, {0x0C, 0x10}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X36 11
 struct xyPoint xyShape16x16Ascii0x36[XY_SHAPE_SIZE_16X16_ASCII_0X36] =
 {
-    {0x00, 0x04}, {0x04, 0x08}, {0x08, 0x08}, {0x0C, 0x04}, {0x08, 0x00}, {0x04, 0x00}, {0x00, 0x04}, {0x00, 0x0C}, 
+    {0x00, 0x04}, {0x04, 0x08}, {0x08, 0x08}, {0x0C, 0x04}, {0x08, 0x00}, {0x04, 0x00}, {0x00, 0x04}, {0x00, 0x0C},
     {0x04, 0x10}, {0x08, 0x10}, {0x0C, 0x0C}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X37 5
 struct xyPoint xyShape16x16Ascii0x37[XY_SHAPE_SIZE_16X16_ASCII_0X37] =
 {
-    {0x06, 0x00}, {0x09, 0x08}, {0x0C, 0x10}, {0x06, 0x10}, {0x00, 0x10}
+    {0x00, 0x10}, {0x06, 0x10}, {0x0C, 0x10}, {0x09, 0x08}, {0x06, 0x00}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X38 12
@@ -184,47 +201,71 @@ struct xyPoint xyShape16x16Ascii0x38[XY_SHAPE_SIZE_16X16_ASCII_0X38] =
 #define XY_SHAPE_SIZE_16X16_ASCII_0X39 11
 struct xyPoint xyShape16x16Ascii0x39[XY_SHAPE_SIZE_16X16_ASCII_0X39] =
 {
-    {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x00}, {0x0C, 0x04}, {0x0C, 0x0C}, {0x08, 0x10}, {0x04, 0x10}, {0x00, 0x0C}, 
+    {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x00}, {0x0C, 0x04}, {0x0C, 0x0C}, {0x08, 0x10}, {0x04, 0x10}, {0x00, 0x0C},
     {0x04, 0x08}, {0x08, 0x08}, {0x0C, 0x0C}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X3A 10
 struct xyPoint xyShape16x16Ascii0x3A[XY_SHAPE_SIZE_16X16_ASCII_0X3A] =
 {
-    {0x05, 0x02}, {0x05, 0x04}, {0x07, 0x04}, {0x07, 0x02}, {0x05, 0x02}, {0x05, 0x0E}, {0x05, 0x0C}, {0x07, 0x0C},
-    {0x07, 0x0E}, {0x05, 0x0E}
+    {0x05, 0x0C}, {0x05, 0x0E}, {0x07, 0x0E}, {0x07, 0x0C}, {0x05, 0x0C}, {0x05, 0x04}, {0x05, 0x02}, {0x07, 0x02},
+    {0x07, 0x04}, {0x05, 0x04}
+};
+
+#define XY_SHAPE_BREAKS_16X16_ASCII_0X3A 1
+const uint16_t xyShapeBreaks16x16Ascii0x3A[XY_SHAPE_BREAKS_16X16_ASCII_0X3A] =
+{
+    5
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X3B 11
 struct xyPoint xyShape16x16Ascii0x3B[XY_SHAPE_SIZE_16X16_ASCII_0X3B] =
 {
-    {0x04, 0x00}, {0x05, 0x04}, {0x07, 0x04}, {0x07, 0x02}, {0x05, 0x00}, {0x04, 0x00}, {0x05, 0x0E}, {0x05, 0x0C},
-    {0x07, 0x0C}, {0x07, 0x0E}, {0x05, 0x0E}
+    {0x05, 0x0C}, {0x05, 0x0E}, {0x07, 0x0E}, {0x07, 0x0C}, {0x05, 0x0C}, {0x05, 0x04}, {0x04, 0x00}, {0x05, 0x00},
+    {0x07, 0x02}, {0x07, 0x04}, {0x05, 0x04}
+};
+
+#define XY_SHAPE_BREAKS_16X16_ASCII_0X3B 1
+const uint16_t xyShapeBreaks16x16Ascii0x3B[XY_SHAPE_BREAKS_16X16_ASCII_0X3B] =
+{
+    5
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X3C 5
 struct xyPoint xyShape16x16Ascii0x3C[XY_SHAPE_SIZE_16X16_ASCII_0X3C] =
 {
-    {0x0C, 0x0E}, {0x06, 0x0B}, {0x00, 0x08}, {0x06, 0x05}, {0x0C, 0x02}
+    {0x0C, 0x02}, {0x06, 0x05}, {0x00, 0x08}, {0x06, 0x0B}, {0x0C, 0x0E}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X3D 6
 struct xyPoint xyShape16x16Ascii0x3D[XY_SHAPE_SIZE_16X16_ASCII_0X3D] =
 {
-    {0x00, 0x04}, {0x06, 0x04}, {0x0C, 0x04}, {0x00, 0x0C}, {0x06, 0x0C}, {0x0C, 0x0C}
+    {0x0C, 0x04}, {0x06, 0x04}, {0x00, 0x04}, {0x00, 0x0C}, {0x06, 0x0C}, {0x0C, 0x0C}
+};
+
+#define XY_SHAPE_BREAKS_16X16_ASCII_0X3D 1
+const uint16_t xyShapeBreaks16x16Ascii0x3D[XY_SHAPE_BREAKS_16X16_ASCII_0X3D] =
+{
+    3
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X3E 5
 struct xyPoint xyShape16x16Ascii0x3E[XY_SHAPE_SIZE_16X16_ASCII_0X3E] =
 {
-    {0x00, 0x0E}, {0x06, 0x0B}, {0x0C, 0x08}, {0x06, 0x05}, {0x00, 0x02}
+    {0x00, 0x02}, {0x06, 0x05}, {0x0C, 0x08}, {0x06, 0x0B}, {0x00, 0x0E}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X3F 12
 struct xyPoint xyShape16x16Ascii0x3F[XY_SHAPE_SIZE_16X16_ASCII_0X3F] =
 {
-    {0x06, 0x04}, {0x06, 0x06}, {0x09, 0x09}, {0x0C, 0x0C}, {0x08, 0x10}, {0x04, 0x10}, {0x00, 0x0C}, {0x06, 0x00},
-    {0x07, 0x01}, {0x06, 0x02}, {0x05, 0x01}, {0x06, 0x00}
+    {0x00, 0x0C}, {0x04, 0x10}, {0x08, 0x10}, {0x0C, 0x0C}, {0x09, 0x09}, {0x06, 0x06}, {0x06, 0x04}, {0x06, 0x02},
+    {0x07, 0x01}, {0x06, 0x00}, {0x05, 0x01}, {0x06, 0x02}
+};
+
+#define XY_SHAPE_BREAKS_16X16_ASCII_0X3F 1
+const uint16_t xyShapeBreaks16x16Ascii0x3F[XY_SHAPE_BREAKS_16X16_ASCII_0X3F] =
+{
+    7
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X40 21
@@ -238,14 +279,14 @@ struct xyPoint xyShape16x16Ascii0x40[XY_SHAPE_SIZE_16X16_ASCII_0X40] =
 #define XY_SHAPE_SIZE_16X16_ASCII_0X41 7
 struct xyPoint xyShape16x16Ascii0x41[XY_SHAPE_SIZE_16X16_ASCII_0X41] =
 {
-    {0x00, 0x00}, {0x03, 0x08}, {0x09, 0x08}, {0x03, 0x08}, {0x06, 0x10}, {0x09, 0x08}, {0x0C, 0x00}
+    {0x00, 0x00}, {0x03, 0x08}, {0x09, 0x08}, {0x06, 0x10}, {0x03, 0x08}, {0x09, 0x08}, {0x0C, 0x00}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X42 11
+#define XY_SHAPE_SIZE_16X16_ASCII_0X42 10
 struct xyPoint xyShape16x16Ascii0x42[XY_SHAPE_SIZE_16X16_ASCII_0X42] =
 {
-    {0x00, 0x00}, {0x08, 0x00}, {0x0C, 0x04}, {0x08, 0x08}, {0x00, 0x08}, {0x08, 0x08}, {0x0C, 0x0C}, {0x08, 0x10},
-    {0x00, 0x10}, {0x00, 0x08}, {0x00, 0x00}
+    {0x00, 0x08}, {0x08, 0x08}, {0x0C, 0x04}, {0x08, 0x00}, {0x00, 0x00}, {0x00, 0x08}, {0x00, 0x10}, {0x08, 0x10},
+    {0x0C, 0x0C}, {0x08, 0x08}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X43 8
@@ -260,58 +301,56 @@ struct xyPoint xyShape16x16Ascii0x44[XY_SHAPE_SIZE_16X16_ASCII_0X44] =
     {0x00, 0x00}, {0x08, 0x00}, {0x0C, 0x04}, {0x0C, 0x0C}, {0x08, 0x10}, {0x00, 0x10}, {0x00, 0x08}, {0x00, 0x00}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X45 11
+#define XY_SHAPE_SIZE_16X16_ASCII_0X45 9
 struct xyPoint xyShape16x16Ascii0x45[XY_SHAPE_SIZE_16X16_ASCII_0X45] =
 {
-    {0x0C, 0x00}, {0x06, 0x00}, {0x00, 0x00}, {0x00, 0x08}, {0x06, 0x08}, {0x0C, 0x08}, {0x06, 0x08}, {0x00, 0x08}, 
-    {0x00, 0x10}, {0x06, 0x10}, {0x0C, 0x10}
+    {0x0C, 0x00}, {0x06, 0x00}, {0x00, 0x00}, {0x00, 0x08}, {0x0C, 0x08}, {0x00, 0x08}, {0x00, 0x10}, {0x06, 0x10},
+    {0x0C, 0x10}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X46 9
+#define XY_SHAPE_SIZE_16X16_ASCII_0X46 8
 struct xyPoint xyShape16x16Ascii0x46[XY_SHAPE_SIZE_16X16_ASCII_0X46] =
 {
-    {0x00, 0x00}, {0x00, 0x08}, {0x06, 0x08}, {0x0C, 0x08}, {0x06, 0x08}, {0x00, 0x08}, {0x00, 0x10}, {0x06, 0x10}, 
-    {0x0C, 0x10}
+    {0x0C, 0x08}, {0x06, 0x08}, {0x00, 0x08}, {0x00, 0x00}, {0x00, 0x08}, {0x00, 0x10}, {0x06, 0x10}, {0x0C, 0x10}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X47 10
 struct xyPoint xyShape16x16Ascii0x47[XY_SHAPE_SIZE_16X16_ASCII_0X47] =
 {
-    {0x08, 0x06}, {0x0C, 0x06}, {0x0C, 0x04}, {0x08, 0x00}, {0x04, 0x00}, {0x00, 0x04}, {0x00, 0x0C}, {0x04, 0x10}, 
+    {0x08, 0x06}, {0x0C, 0x06}, {0x0C, 0x04}, {0x08, 0x00}, {0x04, 0x00}, {0x00, 0x04}, {0x00, 0x0C}, {0x04, 0x10},
     {0x08, 0x10}, {0x0C, 0x0C}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X48 9
 struct xyPoint xyShape16x16Ascii0x48[XY_SHAPE_SIZE_16X16_ASCII_0X48] =
 {
-    {0x00, 0x00}, {0x00, 0x08}, {0x00, 0x10}, {0x00, 0x08}, {0x06, 0x08}, {0x0C, 0x08}, {0x0C, 0x10}, {0x0C, 0x08}, 
+    {0x00, 0x10}, {0x00, 0x08}, {0x00, 0x00}, {0x00, 0x08}, {0x06, 0x08}, {0x0C, 0x08}, {0x0C, 0x10}, {0x0C, 0x08},
     {0x0C, 0x00}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X49 9
 struct xyPoint xyShape16x16Ascii0x49[XY_SHAPE_SIZE_16X16_ASCII_0X49] =
 {
-    {0x00, 0x00}, {0x06, 0x00}, {0x0C, 0x00}, {0x06, 0x00}, {0x06, 0x08}, {0x06, 0x10}, {0x00, 0x10}, {0x06, 0x10}, 
-    {0x0C, 0x10}
+    {0x00, 0x10}, {0x06, 0x10}, {0x0C, 0x10}, {0x06, 0x10}, {0x06, 0x08}, {0x06, 0x00}, {0x00, 0x00}, {0x06, 0x00},
+    {0x0C, 0x00}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X4A 8
 struct xyPoint xyShape16x16Ascii0x4A[XY_SHAPE_SIZE_16X16_ASCII_0X4A] =
 {
-    {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x04}, {0x08, 0x08}, {0x08, 0x10}, {0x00, 0x10}, {0x08, 0x10}, {0x0C, 0x10}
+    {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x04}, {0x08, 0x08}, {0x08, 0x10}, {0x0C, 0x10}, {0x08, 0x10}, {0x00, 0x10}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X4B 10
+#define XY_SHAPE_SIZE_16X16_ASCII_0X4B 8
 struct xyPoint xyShape16x16Ascii0x4B[XY_SHAPE_SIZE_16X16_ASCII_0X4B] =
 {
-    {0x00, 0x00}, {0x00, 0x08}, {0x00, 0x10}, {0x00, 0x08}, {0x06, 0x0C}, {0x0C, 0x10}, {0x06, 0x0C}, {0x00, 0x08}, 
-    {0x06, 0x04}, {0x0C, 0x00}
+    {0x0C, 0x00}, {0x06, 0x04}, {0x00, 0x08}, {0x00, 0x00}, {0x00, 0x10}, {0x00, 0x08}, {0x06, 0x0C}, {0x0C, 0x10}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X4C 7
+#define XY_SHAPE_SIZE_16X16_ASCII_0X4C 5
 struct xyPoint xyShape16x16Ascii0x4C[XY_SHAPE_SIZE_16X16_ASCII_0X4C] =
 {
-    {0x00, 0x00}, {0x00, 0x08}, {0x00, 0x10}, {0x00, 0x08}, {0x00, 0x00}, {0x06, 0x00}, {0x0C, 0x00}
+    {0x00, 0x10}, {0x00, 0x08}, {0x00, 0x00}, {0x06, 0x00}, {0x0C, 0x00}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X4D 7
@@ -329,73 +368,71 @@ struct xyPoint xyShape16x16Ascii0x4E[XY_SHAPE_SIZE_16X16_ASCII_0X4E] =
 #define XY_SHAPE_SIZE_16X16_ASCII_0X4F 9
 struct xyPoint xyShape16x16Ascii0x4F[XY_SHAPE_SIZE_16X16_ASCII_0X4F] =
 {
-    {0x04, 0x00}, {0x00, 0x04}, {0x00, 0x0C}, {0x04, 0x10}, {0x08, 0x10}, {0x0C, 0x0C}, {0x0C, 0x04}, {0x08, 0x00},
-    {0x04, 0x00}
+    {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x00}, {0x0C, 0x04}, {0x0C, 0x0C}, {0x08, 0x10}, {0x04, 0x10}, {0x00, 0x0C},
+    {0x00, 0x04}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X50 8
+#define XY_SHAPE_SIZE_16X16_ASCII_0X50 7
 struct xyPoint xyShape16x16Ascii0x50[XY_SHAPE_SIZE_16X16_ASCII_0X50] =
 {
-    {0x00, 0x00}, {0x00, 0x08}, {0x08, 0x08}, {0x0C, 0x0C}, {0x08, 0x10}, {0x00, 0x10}, {0x00, 0x08}, {0x00, 0x00}
+    {0x00, 0x00}, {0x00, 0x08}, {0x08, 0x08}, {0x0C, 0x0C}, {0x08, 0x10}, {0x00, 0x10}, {0x00, 0x08}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X51 15
+#define XY_SHAPE_SIZE_16X16_ASCII_0X51 12
 struct xyPoint xyShape16x16Ascii0x51[XY_SHAPE_SIZE_16X16_ASCII_0X51] =
 {
-    {0x04, 0x00}, {0x08, 0x00}, {0x04, 0x00}, {0x00, 0x04}, {0x00, 0x0C}, {0x04, 0x10}, {0x08, 0x10}, {0x0C, 0x0C}, 
-    {0x0C, 0x04}, {0x0A, 0x02}, {0x08, 0x04}, {0x0A, 0x02}, {0x08, 0x00}, {0x0A, 0x02}, {0x0C, 0x00}
+    {0x08, 0x04}, {0x0A, 0x02}, {0x0C, 0x04}, {0x0C, 0x0C}, {0x08, 0x10}, {0x04, 0x10}, {0x00, 0x0C}, {0x00, 0x04},
+    {0x04, 0x00}, {0x08, 0x00}, {0x0A, 0x02}, {0x0C, 0x00}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X52 9
 struct xyPoint xyShape16x16Ascii0x52[XY_SHAPE_SIZE_16X16_ASCII_0X52] =
 {
-    {0x00, 0x00}, {0x00, 0x08}, {0x08, 0x08}, {0x0C, 0x0C}, {0x08, 0x10}, {0x00, 0x10}, {0x00, 0x08}, {0x06, 0x04}, 
+    {0x00, 0x00}, {0x00, 0x08}, {0x08, 0x08}, {0x0C, 0x0C}, {0x08, 0x10}, {0x00, 0x10}, {0x00, 0x08}, {0x06, 0x04},
     {0x0C, 0x00}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X53 10
 struct xyPoint xyShape16x16Ascii0x53[XY_SHAPE_SIZE_16X16_ASCII_0X53] =
 {
-    {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x00}, {0x0C, 0x04}, {0x08, 0x08}, {0x04, 0x08}, {0x00, 0x0C}, {0x04, 0x10}, 
+    {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x00}, {0x0C, 0x04}, {0x08, 0x08}, {0x04, 0x08}, {0x00, 0x0C}, {0x04, 0x10},
     {0x08, 0x10}, {0x0C, 0x0C}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X54 6
 struct xyPoint xyShape16x16Ascii0x54[XY_SHAPE_SIZE_16X16_ASCII_0X54] =
 {
-    {0x06, 0x00}, {0x06, 0x08}, {0x06, 0x10}, {0x00, 0x10}, {0x06, 0x10}, {0x0C, 0x10}
+    {0x00, 0x10}, {0x06, 0x10}, {0x0C, 0x10}, {0x06, 0x10}, {0x06, 0x08}, {0x06, 0x00}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X55 11
+#define XY_SHAPE_SIZE_16X16_ASCII_0X55 8
 struct xyPoint xyShape16x16Ascii0x55[XY_SHAPE_SIZE_16X16_ASCII_0X55] =
 {
-    {0x04, 0x00}, {0x00, 0x04}, {0x00, 0x08}, {0x00, 0x10}, {0x00, 0x08}, {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x00}, 
-    {0x0C, 0x04}, {0x0C, 0x08}, {0x0C, 0x10}
+    {0x00, 0x10}, {0x00, 0x08}, {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x00}, {0x0C, 0x04}, {0x0C, 0x08}, {0x0C, 0x10}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X56 7
+#define XY_SHAPE_SIZE_16X16_ASCII_0X56 5
 struct xyPoint xyShape16x16Ascii0x56[XY_SHAPE_SIZE_16X16_ASCII_0X56] =
 {
-    {0x06, 0x00}, {0x03, 0x08}, {0x00, 0x10}, {0x03, 0x08}, {0x06, 0x00}, {0x09, 0x08}, {0x0C, 0x10}
+    {0x00, 0x10}, {0x03, 0x08}, {0x06, 0x00}, {0x09, 0x08}, {0x0C, 0x10}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X57 9
+#define XY_SHAPE_SIZE_16X16_ASCII_0X57 7
 struct xyPoint xyShape16x16Ascii0x57[XY_SHAPE_SIZE_16X16_ASCII_0X57] =
 {
-    {0x00, 0x00}, {0x00, 0x08}, {0x00, 0x10}, {0x00, 0x08}, {0x00, 0x00}, {0x06, 0x08}, {0x0C, 0x00}, {0x0C, 0x08},
-    {0x0C, 0x10}
+    {0x00, 0x10}, {0x00, 0x08}, {0x00, 0x00}, {0x06, 0x08}, {0x0C, 0x00}, {0x0C, 0x08}, {0x0C, 0x10}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X58 7
+#define XY_SHAPE_SIZE_16X16_ASCII_0X58 6
 struct xyPoint xyShape16x16Ascii0x58[XY_SHAPE_SIZE_16X16_ASCII_0X58] =
 {
-    {0x00, 0x00}, {0x06, 0x08}, {0x00, 0x10}, {0x06, 0x08}, {0x0C, 0x10}, {0x06, 0x08}, {0x0C, 0x00}
+    {0x00, 0x10}, {0x06, 0x08}, {0x00, 0x00}, {0x0C, 0x10}, {0x06, 0x08}, {0x0C, 0x00}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X59 5
 struct xyPoint xyShape16x16Ascii0x59[XY_SHAPE_SIZE_16X16_ASCII_0X59] =
 {
-    {0x06, 0x00}, {0x06, 0x08}, {0x00, 0x10}, {0x06, 0x08}, {0x0C, 0x10}
+    {0x00, 0x10}, {0x06, 0x08}, {0x06, 0x00}, {0x06, 0x08}, {0x0C, 0x10}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X5A 7
@@ -407,19 +444,19 @@ struct xyPoint xyShape16x16Ascii0x5A[XY_SHAPE_SIZE_16X16_ASCII_0X5A] =
 #define XY_SHAPE_SIZE_16X16_ASCII_0X5B 5
 struct xyPoint xyShape16x16Ascii0x5B[XY_SHAPE_SIZE_16X16_ASCII_0X5B] =
 {
-    {0x08, 0x10}, {0x04, 0x10}, {0x04, 0x08}, {0x04, 0x00}, {0x08, 0x00}
+    {0x08, 0x00}, {0x04, 0x00}, {0x04, 0x08}, {0x04, 0x10}, {0x08, 0x10}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X5C 3
 struct xyPoint xyShape16x16Ascii0x5C[XY_SHAPE_SIZE_16X16_ASCII_0X5C] =
 {
-    {0x09, 0x00}, {0x06, 0x08}, {0x03, 0x10}
+    {0x03, 0x10}, {0x06, 0x08}, {0x09, 0x00}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X5D 5
 struct xyPoint xyShape16x16Ascii0x5D[XY_SHAPE_SIZE_16X16_ASCII_0X5D] =
 {
-    {0x04, 0x10}, {0x08, 0x10}, {0x08, 0x08}, {0x08, 0x00}, {0x04, 0x00}
+    {0x04, 0x00}, {0x08, 0x00}, {0x08, 0x08}, {0x08, 0x10}, {0x04, 0x10}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X5E 3
@@ -450,21 +487,21 @@ struct xyPoint xyShape16x16Ascii0x61[XY_SHAPE_SIZE_16X16_ASCII_0X61] =
 #define XY_SHAPE_SIZE_16X16_ASCII_0X62 12
 struct xyPoint xyShape16x16Ascii0x62[XY_SHAPE_SIZE_16X16_ASCII_0X62] =
 {
-    {0x00, 0x10}, {0x00, 0x08}, {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x00}, {0x0C, 0x04}, {0x0C, 0x08}, {0x08, 0x0C},
-    {0x04, 0x0C}, {0x00, 0x08}, {0x00, 0x04}, {0x00, 0x00}
+    {0x00, 0x08}, {0x00, 0x04}, {0x00, 0x00}, {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x00}, {0x0C, 0x04}, {0x0C, 0x08},
+    {0x08, 0x0C}, {0x04, 0x0C}, {0x00, 0x08}, {0x00, 0x10}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X63 8
 struct xyPoint xyShape16x16Ascii0x63[XY_SHAPE_SIZE_16X16_ASCII_0X63] =
 {
-    {0x0C, 0x08}, {0x08, 0x0C}, {0x04, 0x0C}, {0x00, 0x08}, {0x00, 0x04}, {0x04, 0x00}, {0x08, 0x00}, {0x0C, 0x04}
+    {0x0C, 0x04}, {0x08, 0x00}, {0x04, 0x00}, {0x00, 0x04}, {0x00, 0x08}, {0x04, 0x0C}, {0x08, 0x0C}, {0x0C, 0x08}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X64 12
 struct xyPoint xyShape16x16Ascii0x64[XY_SHAPE_SIZE_16X16_ASCII_0X64] =
 {
-    {0x0C, 0x10}, {0x0C, 0x08}, {0x0C, 0x04}, {0x08, 0x00}, {0x04, 0x00}, {0x00, 0x04}, {0x00, 0x08}, {0x04, 0x0C},
-    {0x08, 0x0C}, {0x0C, 0x08}, {0x0C, 0x04}, {0x0C, 0x00}
+    {0x0C, 0x08}, {0x0C, 0x04}, {0x0C, 0x00}, {0x0C, 0x04}, {0x08, 0x00}, {0x04, 0x00}, {0x00, 0x04}, {0x00, 0x08},
+    {0x04, 0x0C}, {0x08, 0x0C}, {0x0C, 0x08}, {0x0C, 0x10}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X65 12
@@ -474,11 +511,10 @@ struct xyPoint xyShape16x16Ascii0x65[XY_SHAPE_SIZE_16X16_ASCII_0X65] =
     {0x00, 0x03}, {0x04, 0x00}, {0x08, 0x00}, {0x0C, 0x03}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X66 9
+#define XY_SHAPE_SIZE_16X16_ASCII_0X66 8
 struct xyPoint xyShape16x16Ascii0x66[XY_SHAPE_SIZE_16X16_ASCII_0X66] =
 {
-    {0x04, 0x00}, {0x04, 0x08}, {0x00, 0x08}, {0x08, 0x08}, {0x0C, 0x08}, {0x04, 0x08}, {0x04, 0x0C}, {0x08, 0x10},
-    {0x0C, 0x10}
+    {0x04, 0x00}, {0x04, 0x08}, {0x00, 0x08}, {0x0C, 0x08}, {0x04, 0x08}, {0x04, 0x0C}, {0x08, 0x10}, {0x0C, 0x10}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X67 12
@@ -491,28 +527,40 @@ struct xyPoint xyShape16x16Ascii0x67[XY_SHAPE_SIZE_16X16_ASCII_0X67] =
 #define XY_SHAPE_SIZE_16X16_ASCII_0X68 8
 struct xyPoint xyShape16x16Ascii0x68[XY_SHAPE_SIZE_16X16_ASCII_0X68] =
 {
-    {0x00, 0x00}, {0x00, 0x08}, {0x00, 0x10}, {0x00, 0x08}, {0x04, 0x0C}, {0x08, 0x0C}, {0x0C, 0x08}, {0x0C, 0x00}
+    {0x00, 0x10}, {0x00, 0x08}, {0x00, 0x00}, {0x00, 0x08}, {0x04, 0x0C}, {0x08, 0x0C}, {0x0C, 0x08}, {0x0C, 0x00}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X69 11
 struct xyPoint xyShape16x16Ascii0x69[XY_SHAPE_SIZE_16X16_ASCII_0X69] =
 {
-    {0x04, 0x08}, {0x06, 0x08}, {0x06, 0x04}, {0x06, 0x00}, {0x04, 0x00}, {0x08, 0x00}, {0x06, 0x0E}, {0x07, 0x0D},
-    {0x06, 0x0C}, {0x05, 0x0D}, {0x06, 0x0E}
+    {0x06, 0x0C}, {0x07, 0x0D}, {0x06, 0x0E}, {0x05, 0x0D}, {0x06, 0x0C}, {0x04, 0x08}, {0x06, 0x08}, {0x06, 0x04},
+    {0x06, 0x00}, {0x04, 0x00}, {0x08, 0x00}
+};
+
+#define XY_SHAPE_BREAKS_16X16_ASCII_0X69 1
+const uint16_t xyShapeBreaks16x16Ascii0x69[XY_SHAPE_BREAKS_16X16_ASCII_0X69] =
+{
+    5
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X6A 11
 struct xyPoint xyShape16x16Ascii0x6A[XY_SHAPE_SIZE_16X16_ASCII_0X6A] =
 {
-    {0x06, 0x0C}, {0x08, 0x0C}, {0x08, 0x07}, {0x08, 0x02}, {0x06, 0x00}, {0x04, 0x02}, {0x08, 0x10}, {0x09, 0x0F},
-    {0x08, 0x0D}, {0x07, 0x0F}, {0x08, 0x10}
+    {0x04, 0x02}, {0x06, 0x00}, {0x08, 0x02}, {0x08, 0x07}, {0x08, 0x0C}, {0x06, 0x0C}, {0x08, 0x0D}, {0x09, 0x0F},
+    {0x08, 0x10}, {0x07, 0x0F}, {0x08, 0x0D}
+};
+
+#define XY_SHAPE_BREAKS_16X16_ASCII_0X6A 1
+const uint16_t xyShapeBreaks16x16Ascii0x6A[XY_SHAPE_BREAKS_16X16_ASCII_0X6A] =
+{
+    6
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X6B 10
+#define XY_SHAPE_SIZE_16X16_ASCII_0X6B 9
 struct xyPoint xyShape16x16Ascii0x6B[XY_SHAPE_SIZE_16X16_ASCII_0X6B] =
 {
-    {0x02, 0x00}, {0x02, 0x04}, {0x02, 0x0A}, {0x02, 0x10}, {0x02, 0x0A}, {0x02, 0x04}, {0x04, 0x06}, {0x0A, 0x0C},
-    {0x04, 0x06}, {0x0A, 0x00}
+    {0x02, 0x10}, {0x02, 0x0A}, {0x02, 0x04}, {0x02, 0x00}, {0x02, 0x04}, {0x04, 0x06}, {0x0A, 0x0C}, {0x04, 0x06},
+    {0x0A, 0x00}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X6C 6
@@ -521,11 +569,11 @@ struct xyPoint xyShape16x16Ascii0x6C[XY_SHAPE_SIZE_16X16_ASCII_0X6C] =
     {0x04, 0x10}, {0x06, 0x10}, {0x06, 0x08}, {0x06, 0x00}, {0x04, 0x00}, {0x08, 0x00}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X6D 15
+#define XY_SHAPE_SIZE_16X16_ASCII_0X6D 13
 struct xyPoint xyShape16x16Ascii0x6D[XY_SHAPE_SIZE_16X16_ASCII_0X6D] =
 {
-    {0x00, 0x00}, {0x00, 0x04}, {0x00, 0x09}, {0x00, 0x0C}, {0x00, 0x09}, {0x03, 0x0C}, {0x06, 0x09}, {0x06, 0x04},
-    {0x06, 0x00}, {0x06, 0x04}, {0x06, 0x09}, {0x09, 0x0C}, {0x0C, 0x09}, {0x0C, 0x04}, {0x0C, 0x00}
+    {0x00, 0x00}, {0x00, 0x04}, {0x00, 0x09}, {0x00, 0x0C}, {0x00, 0x09}, {0x03, 0x0C}, {0x06, 0x09}, {0x06, 0x00},
+    {0x06, 0x09}, {0x09, 0x0C}, {0x0C, 0x09}, {0x0C, 0x04}, {0x0C, 0x00}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X6E 11
@@ -569,18 +617,17 @@ struct xyPoint xyShape16x16Ascii0x73[XY_SHAPE_SIZE_16X16_ASCII_0X73] =
     {0x08, 0x0C}, {0x0C, 0x0C}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X74 9
+#define XY_SHAPE_SIZE_16X16_ASCII_0X74 8
 struct xyPoint xyShape16x16Ascii0x74[XY_SHAPE_SIZE_16X16_ASCII_0X74] =
 {
-    {0x04, 0x10}, {0x04, 0x0C}, {0x00, 0x0C}, {0x04, 0x0C}, {0x0C, 0x0C}, {0x04, 0x0C}, {0x04, 0x07}, {0x04, 0x02},
-    {0x06, 0x00}
+    {0x04, 0x10}, {0x04, 0x0C}, {0x00, 0x0C}, {0x0C, 0x0C}, {0x04, 0x0C}, {0x04, 0x07}, {0x04, 0x02}, {0x06, 0x00}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X75 11
 struct xyPoint xyShape16x16Ascii0x75[XY_SHAPE_SIZE_16X16_ASCII_0X75] =
 {
-    {0x0C, 0x0C}, {0x0C, 0x08}, {0x0C, 0x03}, {0x0C, 0x00}, {0x0C, 0x03}, {0x09, 0x00}, {0x06, 0x00}, {0x03, 0x00},
-    {0x00, 0x03}, {0x00, 0x08}, {0x00, 0x0C}
+    {0x00, 0x0C}, {0x00, 0x08}, {0x00, 0x03}, {0x03, 0x00}, {0x06, 0x00}, {0x09, 0x00}, {0x0C, 0x03}, {0x0C, 0x00},
+    {0x0C, 0x03}, {0x0C, 0x08}, {0x0C, 0x0C}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X76 5
@@ -596,16 +643,16 @@ struct xyPoint xyShape16x16Ascii0x77[XY_SHAPE_SIZE_16X16_ASCII_0X77] =
     {0x0C, 0x0C}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X78 7
+#define XY_SHAPE_SIZE_16X16_ASCII_0X78 6
 struct xyPoint xyShape16x16Ascii0x78[XY_SHAPE_SIZE_16X16_ASCII_0X78] =
 {
-    {0x00, 0x00}, {0x06, 0x06}, {0x00, 0x0C}, {0x06, 0x06}, {0x0C, 0x0C}, {0x06, 0x06}, {0x0C, 0x00}
+    {0x00, 0x0C}, {0x06, 0x06}, {0x00, 0x00}, {0x0C, 0x0C}, {0x06, 0x06}, {0x0C, 0x00}
 };
 
-#define XY_SHAPE_SIZE_16X16_ASCII_0X79 8
+#define XY_SHAPE_SIZE_16X16_ASCII_0X79 7
 struct xyPoint xyShape16x16Ascii0x79[XY_SHAPE_SIZE_16X16_ASCII_0X79] =
 {
-    {0x00, 0x0C}, {0x03, 0x08}, {0x06, 0x04}, {0x09, 0x08}, {0x0C, 0x0C}, {0x09, 0x08}, {0x06, 0x04}, {0x03, 0x00}
+    {0x00, 0x0C}, {0x03, 0x08}, {0x06, 0x04}, {0x03, 0x00}, {0x06, 0x04}, {0x09, 0x08}, {0x0C, 0x0C}
 };
 
 #define XY_SHAPE_SIZE_16X16_ASCII_0X7A 7
@@ -614,7 +661,6 @@ struct xyPoint xyShape16x16Ascii0x7A[XY_SHAPE_SIZE_16X16_ASCII_0X7A] =
     {0x00, 0x0C}, {0x06, 0x0C}, {0x0C, 0x0C}, {0x06, 0x06}, {0x00, 0x00}, {0x06, 0x00}, {0x0C, 0x00}
 };
 
-
 #define XY_SHAPE_SIZE_16X16_ASCII_0X7B 9
 struct xyPoint xyShape16x16Ascii0x7B[XY_SHAPE_SIZE_16X16_ASCII_0X7B] =
 {
@@ -641,7 +687,7 @@ struct xyPoint xyShape16x16Ascii0x7E[XY_SHAPE_SIZE_16X16_ASCII_0X7E] =
     {0x00, 0x08}, {0x03, 0x09}, {0x06, 0x08}, {0x09, 0x07}, {0x0C, 0x08}
 };
 
-struct xyPoint* xyShape16x16Ascii[128] = 
+struct xyPoint* xyShape16x16Ascii[128] =
 {
     xyShape16x16Ascii0x00, xyShape16x16Ascii0x00, xyShape16x16Ascii0x00, xyShape16x16Ascii0x00,
     xyShape16x16Ascii0x00, xyShape16x16Ascii0x00, xyShape16x16Ascii0x00, xyShape16x16Ascii0x00,
@@ -677,15 +723,14 @@ struct xyPoint* xyShape16x16Ascii[128] =
     xyShape16x16Ascii0x64, xyShape16x16Ascii0x65, xyShape16x16Ascii0x66, xyShape16x16Ascii0x67,
     xyShape16x16Ascii0x68, xyShape16x16Ascii0x69, xyShape16x16Ascii0x6A, xyShape16x16Ascii0x6B,
     xyShape16x16Ascii0x6C, xyShape16x16Ascii0x6D, xyShape16x16Ascii0x6E, xyShape16x16Ascii0x6F,
-    
+
     xyShape16x16Ascii0x70, xyShape16x16Ascii0x71, xyShape16x16Ascii0x72, xyShape16x16Ascii0x73,
     xyShape16x16Ascii0x74, xyShape16x16Ascii0x75, xyShape16x16Ascii0x76, xyShape16x16Ascii0x77,
     xyShape16x16Ascii0x78, xyShape16x16Ascii0x79, xyShape16x16Ascii0x7A, xyShape16x16Ascii0x7B,
     xyShape16x16Ascii0x7C, xyShape16x16Ascii0x7D, xyShape16x16Ascii0x7E, xyShape16x16Ascii0x00
 };
 
-// TODO: See above symbols
-uint16_t xyShapeSize16x16Ascii[128] = 
+uint16_t xyShapeSize16x16Ascii[128] =
 {
     XY_SHAPE_SIZE_16X16_ASCII_0X00, XY_SHAPE_SIZE_16X16_ASCII_0X00, XY_SHAPE_SIZE_16X16_ASCII_0X00, XY_SHAPE_SIZE_16X16_ASCII_0X00,
     XY_SHAPE_SIZE_16X16_ASCII_0X00, XY_SHAPE_SIZE_16X16_ASCII_0X00, XY_SHAPE_SIZE_16X16_ASCII_0X00, XY_SHAPE_SIZE_16X16_ASCII_0X00,
@@ -727,3 +772,89 @@ uint16_t xyShapeSize16x16Ascii[128] =
     XY_SHAPE_SIZE_16X16_ASCII_0X78, XY_SHAPE_SIZE_16X16_ASCII_0X79, XY_SHAPE_SIZE_16X16_ASCII_0X7A, XY_SHAPE_SIZE_16X16_ASCII_0X7B,
     XY_SHAPE_SIZE_16X16_ASCII_0X7C, XY_SHAPE_SIZE_16X16_ASCII_0X7D, XY_SHAPE_SIZE_16X16_ASCII_0X7E, XY_SHAPE_SIZE_16X16_ASCII_0X00
 };
+
+const uint16_t* xyShapeBreaks16x16Ascii[128] =
+{
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+
+    NULL, xyShapeBreaks16x16Ascii0x21, xyShapeBreaks16x16Ascii0x22, NULL,
+    NULL, xyShapeBreaks16x16Ascii0x25, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, xyShapeBreaks16x16Ascii0x3A, xyShapeBreaks16x16Ascii0x3B,
+    NULL, xyShapeBreaks16x16Ascii0x3D, NULL, xyShapeBreaks16x16Ascii0x3F,
+
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, xyShapeBreaks16x16Ascii0x69, xyShapeBreaks16x16Ascii0x6A, NULL,
+    NULL, NULL, NULL, NULL,
+
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL
+};
+
+uint16_t xyShapeBreakCount16x16Ascii[128] =
+{
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+
+    0, XY_SHAPE_BREAKS_16X16_ASCII_0X21, XY_SHAPE_BREAKS_16X16_ASCII_0X22, 0,
+    0, XY_SHAPE_BREAKS_16X16_ASCII_0X25, 0, 0,
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+    0, 0, XY_SHAPE_BREAKS_16X16_ASCII_0X3A, XY_SHAPE_BREAKS_16X16_ASCII_0X3B,
+    0, XY_SHAPE_BREAKS_16X16_ASCII_0X3D, 0, XY_SHAPE_BREAKS_16X16_ASCII_0X3F,
+
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+    0, XY_SHAPE_BREAKS_16X16_ASCII_0X69, XY_SHAPE_BREAKS_16X16_ASCII_0X6A, 0,
+    0, 0, 0, 0,
+
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+    0, 0, 0, 0
+};
@@ -0,0 +1,376 @@
+// Header
+#include "xy_stream.h"
+
+// Includes -------------------------------------------------------------------------------------------------------------------
+
+#include "xy_packed.h"
+#include "xy_points.h"
+
+// Libraries ------------------------------------------------------------------------------------------------------------------
+
+// C Standard Libraries
+#include <stddef.h>
+
+// Constants ------------------------------------------------------------------------------------------------------------------
+
+#define STREAM_CHUNK_SIZE 32             // Number of points fetched from a shape at a time.
+
+// Function Prototypes --------------------------------------------------------------------------------------------------------
+
+// Append Sample
+// - Call to append a sample holding the specified position for the specified number of ticks.
+// - Dwells longer than XY_SAMPLE_DWELL_MAX are split across multiple samples.
+// - The playback time is added to the stream's durations, as color time if color is set, otherwise as lit time if the beam
+//   is on.
+// - Returns false if the stream is full, in which case the stream is not modified.
+bool streamAppend(xyStream_t* stream, xyCoord_t x, xyCoord_t y, uint32_t dwellTicks, bool color);
+
+// Move in Steps
+// - Call to append a lit move at constant velocity, subdivided into steps no longer than the stream's maximum step (see
+//   xyStreamMove).
+// - Returns false if the stream is full, in which case the stream is not modified.
+bool streamMoveSteps(xyStream_t* stream, xyCoord_t x, xyCoord_t y);
+
+// Check Blank Fits
+// - Call to check whether the stream has space left to turn the beam off (see xyStreamEnd).
+bool streamBlankFits(xyStream_t* stream);
+
+// Check Blanked
+// - Call to check whether the move into the specified point of a shape is blanked, when tracing in the specified direction.
+// - Breaks are searched from the cursor, which is advanced past them. Points must be checked in order of traversal.
+bool streamBlanked(volatile xyShape_t* shape, bool reverse, uint16_t index, int32_t* cursor);
+
+// Fetch Points
+// - Call to get the on-screen positions of a range of points of a shape.
+// - Untransformed shapes are offset in bulk (see 'xy_points.h').
+// - Packed shapes are decoded by the specified reader, which must be positioned at the first point of the range.
+void streamFetch(volatile xyShape_t* shape, xyPackedReader_t* reader, uint16_t first, uint16_t count, xyPoint_t* points);
+
+// Function Definitions -------------------------------------------------------------------------------------------------------
+
+void xyStreamBegin(xyStream_t* stream, xyCoord_t cursorX, xyCoord_t cursorY)
+{
+    stream->sampleCount = 0;
+    stream->colorCount  = 0;
+    stream->cursorX     = cursorX;
+    stream->cursorY     = cursorY;
+
+    stream->lit           = false;
+    stream->color.red     = 0;
+    stream->color.green   = 0;
+    stream->color.blue    = 0;
+    stream->durationTicks = 0;
+    stream->litTicks      = 0;
+    stream->colorTicks    = 0;
+}
+
+bool xyStreamMove(xyStream_t* stream, xyCoord_t x, xyCoord_t y)
+{
+    if(stream->lit && stream->stepMax > 0) return streamMoveSteps(stream, x, y);
+
+    uint32_t dwellTicks = (uint32_t)xyGetMoveDelayUs(stream->cursorX, stream->cursorY, x, y) * XY_STREAM_TICKS_PER_US;
+
+    if(!streamAppend(stream, x, y, dwellTicks, false)) return false;
+
+    stream->cursorX = x;
+    stream->cursorY = y;
+    return true;
+}
+
+bool xyStreamColor(xyStream_t* stream, xyColor_t red, xyColor_t green, xyColor_t blue)
+{
+    // Store state for reverting
+    uint16_t sampleCount   = stream->sampleCount;
+    bool     lit           = stream->lit;
+    xyRgb_t  color         = stream->color;
+    uint32_t durationTicks = stream->durationTicks;
+    uint32_t litTicks      = stream->litTicks;
+
+    if(stream->colorCount >= stream->colorCapacity) return false;
+
+    // A sync flag must follow a sample, and each sample may only carry one sync flag
+    if(sampleCount == 0 || (stream->samples[sampleCount - 1] & XY_SAMPLE_SYNC))
+    {
+        if(!streamAppend(stream, stream->cursorX, stream->cursorY, 0, false)) return false;
+    }
+
+    uint16_t syncIndex = stream->sampleCount - 1;
+    stream->lit         = red != 0 || green != 0 || blue != 0;
+    stream->color.red   = red;
+    stream->color.green = green;
+    stream->color.blue  = blue;
+
+    // Hold the cursor while the color output settles
+    uint32_t dwellTicks = (uint32_t)xyGetColorDelayUs() * XY_STREAM_TICKS_PER_US;
+    if(dwellTicks != 0 && !streamAppend(stream, stream->cursorX, stream->cursorY, dwellTicks, true))
+    {
+        stream->sampleCount   = sampleCount;
+        stream->lit           = lit;
+        stream->color         = color;
+        stream->durationTicks = durationTicks;
+        stream->litTicks      = litTicks;
+        return false;
+    }
+
+    // Apply the color after the sync sample
+    stream->samples[syncIndex] |= XY_SAMPLE_SYNC;
+    stream->colors[stream->colorCount].red   = red;
+    stream->colors[stream->colorCount].green = green;
+    stream->colors[stream->colorCount].blue  = blue;
+    ++stream->colorCount;
+
+    return true;
+}
+
+bool xyStreamMoveColor(xyStream_t* stream, xyCoord_t x, xyCoord_t y, xyColor_t red, xyColor_t green, xyColor_t blue)
+{
+    // Store state for reverting
+    uint16_t  sampleCount   = stream->sampleCount;
+    xyCoord_t cursorX       = stream->cursorX;
+    xyCoord_t cursorY       = stream->cursorY;
+    uint32_t  durationTicks = stream->durationTicks;
+    uint32_t  litTicks      = stream->litTicks;
+
+    uint32_t moveTicks  = (uint32_t)xyGetMoveDelayUs(stream->cursorX, stream->cursorY, x, y) * XY_STREAM_TICKS_PER_US;
+    uint32_t colorTicks = (uint32_t)xyGetColorDelayUs() * XY_STREAM_TICKS_PER_US;
+
+    // Part of the move before the color is applied, the remainder is covered by the color delay
+    if(moveTicks > colorTicks && !streamAppend(stream, x, y, moveTicks - colorTicks, false)) return false;
+
+    stream->cursorX = x;
+    stream->cursorY = y;
+
+    if(!xyStreamColor(stream, red, green, blue))
+    {
+        stream->sampleCount   = sampleCount;
+        stream->cursorX       = cursorX;
+        stream->cursorY       = cursorY;
+        stream->durationTicks = durationTicks;
+        stream->litTicks      = litTicks;
+        return false;
+    }
+
+    return true;
+}
+
+bool xyStreamShape(xyStream_t* stream, volatile xyShape_t* shape, bool reverse)
+{
+    // Ignore shapes that would not be rendered
+    if(shape->pointCount == 0 || (shape->points == NULL && shape->packed == NULL) || !shape->visible) return true;
+
+    // Packed shapes can only be decoded forwards
+    xyPackedReader_t reader;
+    if(shape->packed != NULL)
+    {
+        xyPackedBegin(&reader, shape->packed);
+        reverse = false;
+    }
+
+    // Store state for reverting
+    uint16_t  sampleCount   = stream->sampleCount;
+    uint16_t  colorCount    = stream->colorCount;
+    xyCoord_t cursorX       = stream->cursorX;
+    xyCoord_t cursorY       = stream->cursorY;
+    bool      lit           = stream->lit;
+    xyRgb_t   color         = stream->color;
+    uint32_t  durationTicks = stream->durationTicks;
+    uint32_t  litTicks      = stream->litTicks;
+    uint32_t  colorTicks    = stream->colorTicks;
+
+    bool written = true;
+
+    // Points are fetched in chunks, in traversal order
+    xyPoint_t chunk[STREAM_CHUNK_SIZE];
+    uint16_t  traced = 0;
+
+    // Breaks are met in traversal order
+    int32_t breakCursor = reverse ? (int32_t)shape->breakCount - 1 : 0;
+
+    while(written && traced < shape->pointCount)
+    {
+        uint16_t count = shape->pointCount - traced;
+        if(count > STREAM_CHUNK_SIZE) count = STREAM_CHUNK_SIZE;
+        streamFetch(shape, &reader, reverse ? shape->pointCount - traced - count : traced, count, chunk);
+
+        for(uint16_t index = 0; written && index < count; ++index)
+        {
+            xyPoint_t* point   = &chunk[reverse ? count - 1 - index : index];
+            bool       first   = traced == 0 && index == 0;
+            bool       joined  = first && stream->lit && point->x == stream->cursorX && point->y == stream->cursorY;
+            bool       blanked = !first && shape->breaks != NULL &&
+                streamBlanked(shape, reverse, reverse ? shape->pointCount - 1 - traced - index : traced + index, &breakCursor);
+
+            // Beam off, for the move to the next stroke, or away from the stroke the previous shape left lit
+            if(blanked || (first && stream->lit && !joined)) written = xyStreamColor(stream, 0, 0, 0);
+
+            if(joined)
+            {
+                // Continue the stroke of the previous shape, the color is only written if it differs
+                if(stream->color.red != shape->colorRed || stream->color.green != shape->colorGreen ||
+                    stream->color.blue != shape->colorBlue)
+                {
+                    written = xyStreamColor(stream, shape->colorRed, shape->colorGreen, shape->colorBlue);
+                }
+            }
+            // Beam on, during the blanked move to the first point of each stroke
+            else if(first || blanked)
+            {
+                written = written && xyStreamMoveColor(stream, point->x, point->y, shape->colorRed, shape->colorGreen,
+                    shape->colorBlue);
+            }
+            else written = written && xyStreamMove(stream, point->x, point->y);
+        }
+
+        traced += count;
+    }
+
+    // The beam is left on for the next shape to continue from, space to turn it off must remain (see xyStreamEnd)
+    written = written && (!stream->lit || streamBlankFits(stream));
+
+    if(!written)
+    {
+        // Revert stream, sync flags are only ever set on the samples being discarded
+        stream->sampleCount   = sampleCount;
+        stream->colorCount    = colorCount;
+        stream->cursorX       = cursorX;
+        stream->cursorY       = cursorY;
+        stream->lit           = lit;
+        stream->color         = color;
+        stream->durationTicks = durationTicks;
+        stream->litTicks      = litTicks;
+        stream->colorTicks    = colorTicks;
+        return false;
+    }
+
+    return true;
+}
+
+bool xyStreamEnd(xyStream_t* stream)
+{
+    // Beam off, playback continues from the beginning of the stream
+    return !stream->lit || xyStreamColor(stream, 0, 0, 0);
+}
+
+bool streamAppend(xyStream_t* stream, xyCoord_t x, xyCoord_t y, uint32_t dwellTicks, bool color)
+{
+    uint16_t sampleCount = stream->sampleCount;
+    uint32_t ticks       = 0;
+
+    do
+    {
+        if(stream->sampleCount >= stream->sampleCapacity)
+        {
+            stream->sampleCount = sampleCount;
+            return false;
+        }
+
+        uint16_t   sampleDwell = dwellTicks > XY_SAMPLE_DWELL_MAX ? XY_SAMPLE_DWELL_MAX : dwellTicks;
+        xySample_t sample      = xyGetSample(x, y, sampleDwell);
+        stream->samples[stream->sampleCount] = sample;
+        ++stream->sampleCount;
+
+        ticks      += xyGetSampleTicks(sample);
+        dwellTicks -= sampleDwell;
+    }
+    while(dwellTicks != 0);
+
+    stream->durationTicks += ticks;
+    if(color) stream->colorTicks += ticks;
+    else if(stream->lit) stream->litTicks += ticks;
+
+    return true;
+}
+
+bool streamMoveSteps(xyStream_t* stream, xyCoord_t x, xyCoord_t y)
+{
+    xyCoordLong_t deltaX = (xyCoordLong_t)x - stream->cursorX;
+    xyCoordLong_t deltaY = (xyCoordLong_t)y - stream->cursorY;
+
+    xyCoordLong_t deltaMax = deltaX < 0 ? -deltaX : deltaX;
+    xyCoordLong_t deltaMin = deltaY < 0 ? -deltaY : deltaY;
+    if(deltaMin > deltaMax)
+    {
+        xyCoordLong_t swap = deltaMax;
+        deltaMax = deltaMin;
+        deltaMin = swap;
+    }
+
+    // Store state for reverting
+    uint16_t sampleCount   = stream->sampleCount;
+    uint32_t durationTicks = stream->durationTicks;
+    uint32_t litTicks      = stream->litTicks;
+
+    // The dwell is proportional to the length of the move (alpha max plus beta min, within 7%), spread evenly across its
+    // steps. Steps are rounded to the nearest position, the last landing on the target exactly.
+    xyCoordLong_t length    = deltaMax + (3 * deltaMin >> 3);
+    uint32_t      moveTicks = (uint32_t)stream->stepDwellTicks * length / stream->stepMax;
+    xyCoordLong_t stepCount = (deltaMax + stream->stepMax - 1) / stream->stepMax;
+    if(stepCount == 0) stepCount = 1;
+
+    for(xyCoordLong_t step = 1; step <= stepCount; ++step)
+    {
+        xyCoord_t stepX     = stream->cursorX + (deltaX * step * 2 + (deltaX < 0 ? -stepCount : stepCount)) / (stepCount * 2);
+        xyCoord_t stepY     = stream->cursorY + (deltaY * step * 2 + (deltaY < 0 ? -stepCount : stepCount)) / (stepCount * 2);
+        uint32_t  stepTicks = moveTicks * step / stepCount - moveTicks * (step - 1) / stepCount;
+
+        if(!streamAppend(stream, stepX, stepY, stepTicks, false))
+        {
+            stream->sampleCount   = sampleCount;
+            stream->durationTicks = durationTicks;
+            stream->litTicks      = litTicks;
+            return false;
+        }
+    }
+
+    stream->cursorX = x;
+    stream->cursorY = y;
+    return true;
+}
+
+bool streamBlankFits(xyStream_t* stream)
+{
+    // A sync sample, followed by the samples holding the cursor for the color delay
+    uint32_t dwellTicks  = (uint32_t)xyGetColorDelayUs() * XY_STREAM_TICKS_PER_US;
+    uint32_t sampleCount = 1 + (dwellTicks + XY_SAMPLE_DWELL_MAX - 1) / XY_SAMPLE_DWELL_MAX;
+
+    return stream->colorCount < stream->colorCapacity && stream->sampleCount + sampleCount <= stream->sampleCapacity;
+}
+
+bool streamBlanked(volatile xyShape_t* shape, bool reverse, uint16_t index, int32_t* cursor)
+{
+    if(!reverse)
+    {
+        // The move into a break
+        while(*cursor < shape->breakCount && shape->breaks[*cursor] < index) ++*cursor;
+        return *cursor < shape->breakCount && shape->breaks[*cursor] == index;
+    }
+
+    // The move out of a break, into the point before it
+    while(*cursor >= 0 && shape->breaks[*cursor] > index + 1) --*cursor;
+    return *cursor >= 0 && shape->breaks[*cursor] == index + 1;
+}
+
+void streamFetch(volatile xyShape_t* shape, xyPackedReader_t* reader, uint16_t first, uint16_t count, xyPoint_t* points)
+{
+    if(shape->packed != NULL)
+    {
+        xyPackedRead(reader, points, count);
+
+        if(shape->transformed)
+        {
+            for(uint16_t index = 0; index < count; ++index) points[index] = xyShapeMapPoint(shape, points[index]);
+            return;
+        }
+
+        xyPointsOffset(points, points, count, shape->positionX, shape->positionY);
+        return;
+    }
+
+    if(shape->transformed)
+    {
+        for(uint16_t index = 0; index < count; ++index) points[index] = xyShapeGetPoint(shape, first + index);
+        return;
+    }
+
+    xyPointsOffset(shape->points + first, points, count, shape->positionX, shape->positionY);
+}
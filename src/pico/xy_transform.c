@@ -0,0 +1,211 @@
+// Header
+#include "xy_renderer.h"
+
+// Includes -------------------------------------------------------------------------------------------------------------------
+
+#include "xy_math.h"
+#include "xy_packed.h"
+#include "xy_points.h"
+
+// Libraries ------------------------------------------------------------------------------------------------------------------
+
+// C Standard Libraries
+#include <math.h>
+#include <stddef.h>
+
+// Function Prototypes --------------------------------------------------------------------------------------------------------
+
+// Affine Transform
+// - Call to transform the source points into the destination buffer about the specified origin.
+// - Each point is offset, then multiplied by the Q16.16 matrix [m00 m01; m10 m11], results are rounded to the nearest
+//   coordinate.
+// - Integer math only, 4 multiplies per point. Source and destination may be the same array.
+void shapeAffine(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, xyCoordLong_t offsetX, xyCoordLong_t offsetY, xyFixed_t m00, xyFixed_t m01, xyFixed_t m10, xyFixed_t m11);
+
+// Float to Fixed
+// - Call to convert a floating-point value to the nearest Q16.16 value.
+xyFixed_t shapeFixed(float value);
+
+// Fixed Multiply
+// - Call to multiply two Q16.16 values, rounding to the nearest Q16.16 value.
+xyFixed_t shapeFixedMultiply(xyFixed_t a, xyFixed_t b);
+
+// Function Definitions -------------------------------------------------------------------------------------------------------
+
+void xyShapeCopy(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY)
+{
+    // Copy point values from source
+    xyPointsOffset(source, destination, sourceSize, originX, originY);
+}
+
+void xyShapeAppend(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, uint16_t destinationIndex, xyCoord_t originX, xyCoord_t originY)
+{
+    // Copy point values from source starting from destination index
+    xyPointsOffset(source, destination + destinationIndex, sourceSize, originX, originY);
+}
+
+void xyShapeTranslate(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, xyCoord_t offsetX, xyCoord_t offsetY, float scalarX, float scalarY, float theta)
+{
+    float cosTheta = cosf(theta);
+    float sinTheta = sinf(theta);
+
+    shapeAffine(source, destination, sourceSize, originX, originY, offsetX, offsetY,
+        shapeFixed(cosTheta * scalarX), shapeFixed(-sinTheta * scalarY),
+        shapeFixed(sinTheta * scalarX), shapeFixed( cosTheta * scalarY));
+}
+
+void xyShapeTranslateFixed(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, xyCoord_t offsetX, xyCoord_t offsetY, xyFixed_t scalarX, xyFixed_t scalarY, xyAngle_t theta)
+{
+    xyFixed_t cosTheta = xyFixedCos(theta);
+    xyFixed_t sinTheta = xyFixedSin(theta);
+
+    shapeAffine(source, destination, sourceSize, originX, originY, offsetX, offsetY,
+        shapeFixedMultiply(cosTheta, scalarX), -shapeFixedMultiply(sinTheta, scalarY),
+        shapeFixedMultiply(sinTheta, scalarX),  shapeFixedMultiply(cosTheta, scalarY));
+}
+
+void xyShapeRotate(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, float theta)
+{
+    xyFixed_t cosTheta = shapeFixed(cosf(theta));
+    xyFixed_t sinTheta = shapeFixed(sinf(theta));
+
+    shapeAffine(source, destination, sourceSize, originX, originY, 0, 0, cosTheta, -sinTheta, sinTheta, cosTheta);
+}
+
+void xyShapeRotateFixed(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, xyAngle_t theta)
+{
+    xyFixed_t cosTheta = xyFixedCos(theta);
+    xyFixed_t sinTheta = xyFixedSin(theta);
+
+    shapeAffine(source, destination, sourceSize, originX, originY, 0, 0, cosTheta, -sinTheta, sinTheta, cosTheta);
+}
+
+void xyShapeRotateInt(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, uint8_t theta)
+{
+    // Table values are scaled by 127
+    xyFixed_t cosTheta = cos256x256Signed[theta] * XY_FIXED_ONE / 127;
+    xyFixed_t sinTheta = sin256x256Signed[theta] * XY_FIXED_ONE / 127;
+
+    shapeAffine(source, destination, sourceSize, originX, originY, 0, 0, cosTheta, -sinTheta, sinTheta, cosTheta);
+}
+
+void xyShapeScale(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, float scalarX, float scalarY)
+{
+    shapeAffine(source, destination, sourceSize, originX, originY, 0, 0, shapeFixed(scalarX), 0, 0, shapeFixed(scalarY));
+}
+
+void xyShapeScaleFixed(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, xyFixed_t scalarX, xyFixed_t scalarY)
+{
+    shapeAffine(source, destination, sourceSize, originX, originY, 0, 0, scalarX, 0, 0, scalarY);
+}
+
+void xyShapeTransform(volatile xyShape_t* shape, xyCoord_t originX, xyCoord_t originY, xyCoord_t offsetX, xyCoord_t offsetY, xyFixed_t scalarX, xyFixed_t scalarY, xyAngle_t theta)
+{
+    xyFixed_t cosTheta = xyFixedCos(theta);
+    xyFixed_t sinTheta = xyFixedSin(theta);
+
+    // Linear part, scale then rotation
+    xyFixed_t m00 =  shapeFixedMultiply(cosTheta, scalarX);
+    xyFixed_t m01 = -shapeFixedMultiply(sinTheta, scalarY);
+    xyFixed_t m10 =  shapeFixedMultiply(sinTheta, scalarX);
+    xyFixed_t m11 =  shapeFixedMultiply(cosTheta, scalarY);
+
+    // Translation part, maps the offset origin back onto the origin
+    xyCoordLong_t x = (xyCoordLong_t)offsetX - originX;
+    xyCoordLong_t y = (xyCoordLong_t)offsetY - originY;
+
+    shape->transform.m00 = m00;
+    shape->transform.m01 = m01;
+    shape->transform.m02 = x * m00 + y * m01 + originX * XY_FIXED_ONE;
+    shape->transform.m10 = m10;
+    shape->transform.m11 = m11;
+    shape->transform.m12 = x * m10 + y * m11 + originY * XY_FIXED_ONE;
+    shape->transformed   = true;
+}
+
+xyPoint_t xyShapeGetPoint(volatile xyShape_t* shape, uint16_t index)
+{
+    xyPoint_t point;
+
+    if(shape->packed != NULL)
+    {
+        // Decode up to the point
+        xyPackedReader_t reader;
+        xyPackedBegin(&reader, shape->packed);
+        for(uint16_t skipped = 0; skipped <= index; ++skipped) xyPackedRead(&reader, &point, 1);
+    }
+    else
+    {
+        point.x = shape->points[index].x;
+        point.y = shape->points[index].y;
+    }
+
+    return xyShapeMapPoint(shape, point);
+}
+
+xyPoint_t xyShapeMapPoint(volatile xyShape_t* shape, xyPoint_t point)
+{
+    xyCoordLong_t x = point.x;
+    xyCoordLong_t y = point.y;
+
+    if(shape->transformed)
+    {
+        xyCoordLong_t xPrime = (x * shape->transform.m00 + y * shape->transform.m01 + shape->transform.m02 + XY_FIXED_ONE / 2) >> 16;
+        xyCoordLong_t yPrime = (x * shape->transform.m10 + y * shape->transform.m11 + shape->transform.m12 + XY_FIXED_ONE / 2) >> 16;
+
+        x = xPrime;
+        y = yPrime;
+    }
+
+    point.x = (xyCoord_t)(x + shape->positionX);
+    point.y = (xyCoord_t)(y + shape->positionY);
+
+    return point;
+}
+
+void xyShapeMultiply(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, xyCoord_t scalarX, xyCoord_t scalarY)
+{
+    for(uint16_t index = 0; index < sourceSize; ++index)
+    {
+        xyCoordLong_t x = (xyCoordLong_t)source[index].x - originX;
+        xyCoordLong_t y = (xyCoordLong_t)source[index].y - originY;
+
+        destination[index].x = (xyCoord_t)(x * scalarX + originX);
+        destination[index].y = (xyCoord_t)(y * scalarY + originY);
+    }
+}
+
+void xyShapeDivide(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, xyCoord_t divisorX, xyCoord_t divisorY)
+{
+    for(uint16_t index = 0; index < sourceSize; ++index)
+    {
+        xyCoordLong_t x = (xyCoordLong_t)source[index].x - originX;
+        xyCoordLong_t y = (xyCoordLong_t)source[index].y - originY;
+
+        destination[index].x = (xyCoord_t)(x / divisorX + originX);
+        destination[index].y = (xyCoord_t)(y / divisorY + originY);
+    }
+}
+
+void shapeAffine(volatile xyPoint_t* source, volatile xyPoint_t* destination, uint16_t sourceSize, xyCoord_t originX, xyCoord_t originY, xyCoordLong_t offsetX, xyCoordLong_t offsetY, xyFixed_t m00, xyFixed_t m01, xyFixed_t m10, xyFixed_t m11)
+{
+    for(uint16_t index = 0; index < sourceSize; ++index)
+    {
+        xyCoordLong_t x = (xyCoordLong_t)source[index].x + offsetX - originX;
+        xyCoordLong_t y = (xyCoordLong_t)source[index].y + offsetY - originY;
+
+        // Products are Q16.16, add one half and shift to round
+        destination[index].x = (xyCoord_t)(((x * m00 + y * m01 + XY_FIXED_ONE / 2) >> 16) + originX);
+        destination[index].y = (xyCoord_t)(((x * m10 + y * m11 + XY_FIXED_ONE / 2) >> 16) + originY);
+    }
+}
+
+xyFixed_t shapeFixed(float value)
+{
+    return (xyFixed_t)lroundf(value * XY_FIXED_ONE);
+}
+
+xyFixed_t shapeFixedMultiply(xyFixed_t a, xyFixed_t b)
+{
+    return (xyFixed_t)(((int64_t)a * b + XY_FIXED_ONE / 2) >> 16);
+}
@@ -0,0 +1,1072 @@
+// Glyph Stroke Optimizer -----------------------------------------------------------------------------------------------------
+//
+// Author: Cole Barach
+//
+// Description: Offline compiler for the 16x16 ASCII glyphs (see 'xy_shapes.h'). Reads the glyph tables the host library was
+//   built with and outputs a regenerated 'xy_shapes.c', each glyph traced with the least draw time.
+//
+//   Each glyph is decomposed into the set of segments it draws. Moves are split at any glyph point lying on them, so that
+//   overlapping moves reduce to identical segments, and every segment is kept once. The segments are then traversed as an
+//   Eulerian path. Odd vertices are joined in pairs, each pair either by retracing the shortest path between them or by a
+//   blanked move (a break, see 'xyShape_t'), whichever is cheaper, the pair left unjoined being the ends of the path. Every
+//   pairing is searched. Strokes left disconnected are spliced in by blanked moves, cheapest first.
+//
+//   Costs are the stream timing of the renderer: the RC settling time of each move, plus two color changes per blanked move.
+//   Draw times in the report are measured by compiling each glyph into a stream (see 'xy_stream.h').
+//
+//   The original tables traced each glyph as a single polyline, so strokes were joined by moves drawn with the beam on. These
+//   moves are listed below and removed. Glyph points are never moved, a point the glyph stops at is kept.
+//
+// Usage: ./optimize_glyphs.out [-p <us>] > xy_shapes.c
+//   -p <us> - Penalty added to each retraced segment, in microseconds. Retraced segments are drawn twice as bright, a penalty
+//             trades draw time for a more even brightness. Defaults to 0.
+//
+//   The regenerated tables are written to stdout, the report to stderr.
+
+// Libraries ------------------------------------------------------------------------------------------------------------------
+
+// X-Y Library
+#include <xy_hardware.h>
+#include <xy_renderer.h>
+#include <xy_shapes.h>
+#include <xy_stream.h>
+
+// C Standard Libraries
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Parameters -----------------------------------------------------------------------------------------------------------------
+
+// Same setup as every example
+#define RC_CONSTANT_US 4
+#define RC_PIXEL_THRES 1
+#define Z_DELAY_US     20
+
+#define GLYPH_COUNT    128               // Size of the ASCII table.
+#define VERTEX_MAX     64                // Maximum number of distinct points in a glyph.
+#define EDGE_MAX       256               // Maximum number of segments of a glyph, including retraced and blanked moves.
+#define ODD_MAX        16                // Maximum number of odd vertices in a glyph to search every pairing of.
+#define STREAM_SIZE    1024              // Size of the stream used to measure draw times.
+
+// Connectors -----------------------------------------------------------------------------------------------------------------
+
+// Stroke Connector
+// - Move of the original tables drawn only to join 2 strokes of a glyph. Has no effect once removed from the tables.
+struct connector
+{
+    uint8_t   glyph;
+    xyPoint_t from;
+    xyPoint_t to;
+};
+
+struct connector connectors[] =
+{
+    { '!', {0x07, 0x00}, {0x08, 0x10} },
+    { '"', {0x02, 0x0A}, {0x0A, 0x0A} },
+    { '%', {0x0C, 0x10}, {0x03, 0x10} },
+    { '%', {0x03, 0x10}, {0x09, 0x00} },
+    { ':', {0x05, 0x02}, {0x05, 0x0E} },
+    { ';', {0x04, 0x00}, {0x05, 0x0E} },
+    { '=', {0x0C, 0x04}, {0x00, 0x0C} },
+    { '?', {0x00, 0x0C}, {0x06, 0x00} },
+    { 'i', {0x08, 0x00}, {0x06, 0x0E} },
+    { 'j', {0x04, 0x02}, {0x08, 0x10} }
+};
+
+// Datatypes ------------------------------------------------------------------------------------------------------------------
+
+// Edge Kinds
+// - Lit edges are segments of the glyph (or retraces of them), blank edges are blanked moves, virtual edges join the path's
+//   ends through the virtual vertex and are not drawn.
+enum edgeKind
+{
+    EDGE_LIT,
+    EDGE_BLANK,
+    EDGE_VIRTUAL
+};
+
+struct edge
+{
+    int           a;
+    int           b;
+    enum edgeKind kind;
+};
+
+// Glyph Graph
+// - Distinct points of a glyph and the distinct segments between them. Components are the connected strokes.
+// - Shortest paths may retrace a straight line across several collinear segments in a single move.
+struct graph
+{
+    xyPoint_t   vertices[VERTEX_MAX];
+    int         vertexCount;
+    struct edge edges[EDGE_MAX];
+    int         edgeCount;
+    struct edge moves[EDGE_MAX];         // Lit moves of the glyph as traced, before splitting.
+    int         moveCount;
+    int         component[VERTEX_MAX];
+    int         componentCount;
+    int         degree[VERTEX_MAX];
+    uint32_t    distance[VERTEX_MAX][VERTEX_MAX]; // Cost of the shortest lit path between 2 vertices, UINT32_MAX if none.
+    int         next[VERTEX_MAX][VERTEX_MAX];     // Next vertex of said path.
+};
+
+// Pairing
+// - Assignment of the odd vertices. Each is either joined to another by a retrace or a blanked move, or is an end of the
+//   path.
+enum pairKind
+{
+    PAIR_RETRACE,
+    PAIR_BLANK,
+    PAIR_OPEN
+};
+
+struct pairing
+{
+    int           a[ODD_MAX / 2];
+    int           b[ODD_MAX / 2];
+    enum pairKind kind[ODD_MAX / 2];
+    int           count;
+    int           start;                 // First vertex of the path.
+    int           end;                   // Last vertex of the path.
+};
+
+// Search Result
+struct result
+{
+    uint32_t       cost;
+    int            breaks;
+    int            bias;                 // Tie-break, prefers paths running left to right.
+    struct pairing pairing;
+};
+
+// Global Memory --------------------------------------------------------------------------------------------------------------
+
+uint32_t retracePenalty = 0;
+
+xySample_t samples[STREAM_SIZE];
+xyRgb_t    colors[STREAM_SIZE];
+
+// Costs ----------------------------------------------------------------------------------------------------------------------
+
+uint32_t litCost(xyPoint_t a, xyPoint_t b)
+{
+    return xyGetMoveDelayUs(a.x, a.y, b.x, b.y);
+}
+
+uint32_t blankCost(xyPoint_t a, xyPoint_t b)
+{
+    return xyGetMoveDelayUs(a.x, a.y, b.x, b.y) + 2 * xyGetColorDelayUs();
+}
+
+// Draw Time
+// - Measures the time to draw the specified glyph by compiling it into a stream, starting from its first point.
+double drawTimeUs(xyPoint_t* points, uint16_t pointCount, const uint16_t* breaks, uint16_t breakCount)
+{
+    if(pointCount == 0) return 0;
+
+    xyShape_t shape =
+    {
+        .points      = points,
+        .pointCount  = pointCount,
+        .packed      = NULL,
+        .breaks      = breaks,
+        .breakCount  = breakCount,
+        .positionX   = 0,
+        .positionY   = 0,
+        .colorRed    = 255,
+        .colorGreen  = 255,
+        .colorBlue   = 255,
+        .visible     = true,
+        .transformed = false
+    };
+
+    xyStream_t stream =
+    {
+        .samples        = samples,
+        .sampleCapacity = STREAM_SIZE,
+        .colors         = colors,
+        .colorCapacity  = STREAM_SIZE
+    };
+
+    xyStreamBegin(&stream, points[0].x, points[0].y);
+    if(!xyStreamShape(&stream, &shape, false) || !xyStreamEnd(&stream))
+    {
+        fprintf(stderr, "Glyph does not fit in the stream\n");
+        exit(1);
+    }
+
+    return (double)stream.durationTicks / XY_STREAM_TICKS_PER_US;
+}
+
+// Graph ----------------------------------------------------------------------------------------------------------------------
+
+int graphVertex(struct graph* graph, xyPoint_t point)
+{
+    for(int index = 0; index < graph->vertexCount; ++index)
+    {
+        if(graph->vertices[index].x == point.x && graph->vertices[index].y == point.y) return index;
+    }
+
+    if(graph->vertexCount == VERTEX_MAX)
+    {
+        fprintf(stderr, "Glyph exceeds %i points\n", VERTEX_MAX);
+        exit(1);
+    }
+
+    graph->vertices[graph->vertexCount] = point;
+    return graph->vertexCount++;
+}
+
+void graphEdge(struct graph* graph, int a, int b, enum edgeKind kind)
+{
+    if(graph->edgeCount == EDGE_MAX)
+    {
+        fprintf(stderr, "Glyph exceeds %i segments\n", EDGE_MAX);
+        exit(1);
+    }
+
+    graph->edges[graph->edgeCount].a    = a;
+    graph->edges[graph->edgeCount].b    = b;
+    graph->edges[graph->edgeCount].kind = kind;
+    ++graph->edgeCount;
+}
+
+// Point on Segment
+// - Checks whether a point lies strictly between the ends of a segment. Returns its position along the segment, 0 if not.
+int32_t graphOnSegment(xyPoint_t a, xyPoint_t b, xyPoint_t point)
+{
+    int32_t deltaX  = b.x - a.x;
+    int32_t deltaY  = b.y - a.y;
+    int32_t offsetX = point.x - a.x;
+    int32_t offsetY = point.y - a.y;
+
+    if(deltaX * offsetY - deltaY * offsetX != 0) return 0;
+
+    int32_t position = deltaX * offsetX + deltaY * offsetY;
+    int32_t length   = deltaX * deltaX + deltaY * deltaY;
+    if(position <= 0 || position >= length) return 0;
+
+    return position;
+}
+
+// Point on Line
+// - Checks whether a point lies on a segment, ends included.
+bool graphOnLine(xyPoint_t a, xyPoint_t b, xyPoint_t point)
+{
+    if(point.x == a.x && point.y == a.y) return true;
+    if(point.x == b.x && point.y == b.y) return true;
+    return graphOnSegment(a, b, point) != 0;
+}
+
+bool graphIsConnector(uint8_t glyph, xyPoint_t from, xyPoint_t to)
+{
+    for(size_t index = 0; index < sizeof(connectors) / sizeof(connectors[0]); ++index)
+    {
+        struct connector* connector = &connectors[index];
+        if(connector->glyph != glyph) continue;
+
+        if(connector->from.x == from.x && connector->from.y == from.y && connector->to.x == to.x && connector->to.y == to.y)
+            return true;
+        if(connector->from.x == to.x && connector->from.y == to.y && connector->to.x == from.x && connector->to.y == from.y)
+            return true;
+    }
+
+    return false;
+}
+
+// Add Move
+// - Adds the segments of a lit move to the graph, split at every vertex lying on it. Segments already in the graph are not
+//   added again. Returns the number of segments the move traces.
+int graphAddMove(struct graph* graph, int from, int to)
+{
+    xyPoint_t a = graph->vertices[from];
+    xyPoint_t b = graph->vertices[to];
+
+    // Vertices on the move, in order from the start
+    int     splits[VERTEX_MAX];
+    int32_t positions[VERTEX_MAX];
+    int     splitCount = 0;
+
+    for(int index = 0; index < graph->vertexCount; ++index)
+    {
+        int32_t position = graphOnSegment(a, b, graph->vertices[index]);
+        if(position == 0) continue;
+
+        int insert = splitCount++;
+        while(insert > 0 && positions[insert - 1] > position)
+        {
+            splits[insert]    = splits[insert - 1];
+            positions[insert] = positions[insert - 1];
+            --insert;
+        }
+
+        splits[insert]    = index;
+        positions[insert] = position;
+    }
+
+    splits[splitCount++] = to;
+
+    int previous = from;
+    for(int index = 0; index < splitCount; ++index)
+    {
+        int vertex = splits[index];
+
+        bool exists = false;
+        for(int edge = 0; edge < graph->edgeCount && !exists; ++edge)
+        {
+            struct edge* e = &graph->edges[edge];
+            exists = (e->a == previous && e->b == vertex) || (e->a == vertex && e->b == previous);
+        }
+
+        if(!exists) graphEdge(graph, previous, vertex, EDGE_LIT);
+        previous = vertex;
+    }
+
+    return splitCount;
+}
+
+// Build Graph
+// - Builds the graph of the segments drawn by the specified glyph. Returns the number of segments traced, retraces included.
+// - If a seed graph is specified, its vertices are added first, so that moves passing through them are split the same way.
+int graphBuild(struct graph* graph, struct graph* seed, uint8_t glyph, xyPoint_t* points, uint16_t pointCount,
+    const uint16_t* breaks, uint16_t breakCount)
+{
+    memset(graph, 0, sizeof(*graph));
+
+    if(seed != NULL)
+    {
+        for(int index = 0; index < seed->vertexCount; ++index) graphVertex(graph, seed->vertices[index]);
+    }
+
+    // Vertices must be known before splitting
+    for(uint16_t index = 0; index < pointCount; ++index) graphVertex(graph, points[index]);
+
+    // Sorted, so that the search does not depend on the order the glyph is traced in
+    for(int index = 1; index < graph->vertexCount; ++index)
+    {
+        xyPoint_t vertex = graph->vertices[index];
+        int insert = index;
+        while(insert > 0 && (graph->vertices[insert - 1].x > vertex.x ||
+            (graph->vertices[insert - 1].x == vertex.x && graph->vertices[insert - 1].y > vertex.y)))
+        {
+            graph->vertices[insert] = graph->vertices[insert - 1];
+            --insert;
+        }
+
+        graph->vertices[insert] = vertex;
+    }
+
+    int      traced     = 0;
+    uint16_t breakIndex = 0;
+    for(uint16_t index = 1; index < pointCount; ++index)
+    {
+        while(breakIndex < breakCount && breaks[breakIndex] < index) ++breakIndex;
+        if(breakIndex < breakCount && breaks[breakIndex] == index) continue;
+
+        int from = graphVertex(graph, points[index - 1]);
+        int to   = graphVertex(graph, points[index]);
+        if(from == to || graphIsConnector(glyph, points[index - 1], points[index])) continue;
+
+        graph->moves[graph->moveCount].a    = from;
+        graph->moves[graph->moveCount].b    = to;
+        graph->moves[graph->moveCount].kind = EDGE_LIT;
+        ++graph->moveCount;
+
+        traced += graphAddMove(graph, from, to);
+    }
+
+    return traced;
+}
+
+// Get Chain
+// - Checks whether the straight line between 2 vertices is covered by segments of the graph. Returns the number of segments
+//   covering it, 0 if not covered.
+int graphChain(struct graph* graph, int from, int to)
+{
+    xyPoint_t a = graph->vertices[from];
+    xyPoint_t b = graph->vertices[to];
+
+    int pieces = 0;
+    for(int edge = 0; edge < graph->edgeCount; ++edge)
+    {
+        xyPoint_t c = graph->vertices[graph->edges[edge].a];
+        xyPoint_t d = graph->vertices[graph->edges[edge].b];
+        if(graphOnLine(a, b, c) && graphOnLine(a, b, d)) ++pieces;
+    }
+
+    // Each vertex on the line divides it once more
+    int divisions = 1;
+    for(int vertex = 0; vertex < graph->vertexCount; ++vertex)
+    {
+        if(graphOnSegment(a, b, graph->vertices[vertex]) != 0) ++divisions;
+    }
+
+    return pieces == divisions ? pieces : 0;
+}
+
+// Check Spanned
+// - Checks whether 2 consecutive moves of a path, through the specified points, were traced as a single move of the glyph.
+bool graphSpanned(struct graph* graph, xyPoint_t a, xyPoint_t b, xyPoint_t c)
+{
+    if(graphOnSegment(a, c, b) == 0) return false;
+
+    for(int move = 0; move < graph->moveCount; ++move)
+    {
+        xyPoint_t p = graph->vertices[graph->moves[move].a];
+        xyPoint_t q = graph->vertices[graph->moves[move].b];
+        if(graphOnLine(p, q, a) && graphOnLine(p, q, c)) return true;
+    }
+
+    return false;
+}
+
+// Analyze Graph
+// - Computes the components, degrees, and shortest lit paths of the graph.
+void graphAnalyze(struct graph* graph)
+{
+    int count = graph->vertexCount;
+
+    for(int index = 0; index < count; ++index) graph->component[index] = -1;
+
+    graph->componentCount = 0;
+    for(int root = 0; root < count; ++root)
+    {
+        if(graph->component[root] != -1) continue;
+
+        // Flood fill
+        int stack[VERTEX_MAX];
+        int top = 0;
+        stack[top++] = root;
+        graph->component[root] = graph->componentCount;
+
+        while(top != 0)
+        {
+            int vertex = stack[--top];
+            for(int edge = 0; edge < graph->edgeCount; ++edge)
+            {
+                struct edge* e = &graph->edges[edge];
+                int other = e->a == vertex ? e->b : e->b == vertex ? e->a : -1;
+                if(other == -1 || graph->component[other] != -1) continue;
+
+                graph->component[other] = graph->componentCount;
+                stack[top++] = other;
+            }
+        }
+
+        ++graph->componentCount;
+    }
+
+    for(int a = 0; a < count; ++a)
+    {
+        graph->degree[a] = 0;
+        for(int b = 0; b < count; ++b)
+        {
+            graph->distance[a][b] = a == b ? 0 : UINT32_MAX;
+            graph->next[a][b]     = b;
+        }
+    }
+
+    for(int edge = 0; edge < graph->edgeCount; ++edge)
+    {
+        struct edge* e = &graph->edges[edge];
+        ++graph->degree[e->a];
+        ++graph->degree[e->b];
+
+        uint32_t cost = litCost(graph->vertices[e->a], graph->vertices[e->b]) + retracePenalty;
+        graph->distance[e->a][e->b] = cost;
+        graph->distance[e->b][e->a] = cost;
+    }
+
+    // Straight lines across collinear segments
+    for(int a = 0; a < count; ++a)
+    {
+        for(int b = a + 1; b < count; ++b)
+        {
+            int pieces = graphChain(graph, a, b);
+            if(pieces < 2) continue;
+
+            uint32_t cost = litCost(graph->vertices[a], graph->vertices[b]) + retracePenalty * pieces;
+            if(cost < graph->distance[a][b])
+            {
+                graph->distance[a][b] = cost;
+                graph->distance[b][a] = cost;
+            }
+        }
+    }
+
+    // Floyd-Warshall
+    for(int via = 0; via < count; ++via)
+    {
+        for(int a = 0; a < count; ++a)
+        {
+            if(graph->distance[a][via] == UINT32_MAX) continue;
+
+            for(int b = 0; b < count; ++b)
+            {
+                if(graph->distance[via][b] == UINT32_MAX) continue;
+
+                uint32_t distance = graph->distance[a][via] + graph->distance[via][b];
+                if(distance < graph->distance[a][b])
+                {
+                    graph->distance[a][b] = distance;
+                    graph->next[a][b]     = graph->next[a][via];
+                }
+            }
+        }
+    }
+}
+
+// Search ---------------------------------------------------------------------------------------------------------------------
+
+// Splice Strokes
+// - Joins the strokes left disconnected by a pairing, each spliced into a blanked (or virtual) move of the path, cheapest
+//   first. Returns the added cost and the number of blanked moves of the path. If the output graph is specified, the moves
+//   between strokes are added to it.
+uint32_t searchSplice(struct graph* graph, struct pairing* pairing, int* breaks, struct graph* output)
+{
+    int count         = graph->vertexCount;
+    int virtualVertex = count;
+
+    // Moves strokes may be spliced into, the virtual vertex being both ends of the path
+    struct edge hosts[VERTEX_MAX + ODD_MAX];
+    int         hostCount = 0;
+
+    hosts[hostCount++] = (struct edge) { virtualVertex, pairing->start, EDGE_VIRTUAL };
+    hosts[hostCount++] = (struct edge) { pairing->end, virtualVertex, EDGE_VIRTUAL };
+
+    // Components joined to the path
+    bool joined[VERTEX_MAX] = { false };
+    joined[graph->component[pairing->start]] = true;
+    joined[graph->component[pairing->end]]   = true;
+
+    // Blanked pairs join components, once either is joined to the path
+    bool pending[ODD_MAX / 2] = { false };
+    for(int index = 0; index < pairing->count; ++index) pending[index] = pairing->kind[index] == PAIR_BLANK;
+
+    uint32_t cost = 0;
+    while(true)
+    {
+        bool changed = true;
+        while(changed)
+        {
+            changed = false;
+            for(int index = 0; index < pairing->count; ++index)
+            {
+                if(!pending[index]) continue;
+
+                int a = pairing->a[index];
+                int b = pairing->b[index];
+                if(!joined[graph->component[a]] && !joined[graph->component[b]]) continue;
+
+                joined[graph->component[a]] = true;
+                joined[graph->component[b]] = true;
+                hosts[hostCount++] = (struct edge) { a, b, EDGE_BLANK };
+                pending[index] = false;
+                changed = true;
+            }
+        }
+
+        // Cheapest splice of any disconnected vertex
+        uint32_t bestCost   = UINT32_MAX;
+        int      bestVertex = -1;
+        int      bestHost   = -1;
+
+        for(int vertex = 0; vertex < count; ++vertex)
+        {
+            if(joined[graph->component[vertex]]) continue;
+
+            xyPoint_t point = graph->vertices[vertex];
+            for(int host = 0; host < hostCount; ++host)
+            {
+                struct edge* e = &hosts[host];
+
+                uint32_t spliceCost;
+                if(e->a == virtualVertex) spliceCost = blankCost(point, graph->vertices[e->b]);
+                else if(e->b == virtualVertex) spliceCost = blankCost(graph->vertices[e->a], point);
+                else
+                {
+                    spliceCost = blankCost(graph->vertices[e->a], point) + blankCost(point, graph->vertices[e->b]) -
+                        blankCost(graph->vertices[e->a], graph->vertices[e->b]);
+                }
+
+                if(spliceCost < bestCost)
+                {
+                    bestCost   = spliceCost;
+                    bestVertex = vertex;
+                    bestHost   = host;
+                }
+            }
+        }
+
+        if(bestVertex == -1) break;
+
+        // Replace the host by 2 moves through the vertex
+        struct edge host = hosts[bestHost];
+        hosts[bestHost]    = (struct edge) { host.a, bestVertex, host.a == virtualVertex ? EDGE_VIRTUAL : EDGE_BLANK };
+        hosts[hostCount++] = (struct edge) { bestVertex, host.b, host.b == virtualVertex ? EDGE_VIRTUAL : EDGE_BLANK };
+        joined[graph->component[bestVertex]] = true;
+        cost += bestCost;
+    }
+
+    *breaks = 0;
+    for(int host = 0; host < hostCount; ++host)
+    {
+        if(hosts[host].kind == EDGE_BLANK) ++*breaks;
+        if(output != NULL) graphEdge(output, hosts[host].a, hosts[host].b, hosts[host].kind);
+    }
+
+    return cost;
+}
+
+// Keep Result
+// - Replaces the best result by the specified one if it is cheaper.
+void searchKeep(struct result* best, struct pairing* pairing, uint32_t cost, int breaks, int bias)
+{
+    if(cost > best->cost) return;
+    if(cost == best->cost && (breaks > best->breaks || (breaks == best->breaks && bias >= best->bias))) return;
+
+    best->cost    = cost;
+    best->breaks  = breaks;
+    best->bias    = bias;
+    best->pairing = *pairing;
+}
+
+// Search Pairings
+// - Recursively assigns the unpaired odd vertices, keeping the cheapest complete pairing.
+void searchPairings(struct graph* graph, int* odd, int oddCount, bool* paired, struct pairing* pairing, uint32_t cost,
+    struct result* best)
+{
+    if(cost > best->cost) return;
+
+    int first = -1;
+    for(int index = 0; index < oddCount && first == -1; ++index)
+    {
+        if(!paired[index]) first = index;
+    }
+
+    // Complete, the open pair is mandatory
+    if(first == -1)
+    {
+        if(pairing->start == -1) return;
+
+        int      breaks;
+        uint32_t total = cost + searchSplice(graph, pairing, &breaks, NULL);
+        searchKeep(best, pairing, total, breaks, graph->vertices[pairing->start].x - graph->vertices[pairing->end].x);
+        return;
+    }
+
+    paired[first] = true;
+    for(int index = first + 1; index < oddCount; ++index)
+    {
+        if(paired[index]) continue;
+        paired[index] = true;
+
+        int a    = odd[first];
+        int b    = odd[index];
+        int slot = pairing->count++;
+        pairing->a[slot] = a;
+        pairing->b[slot] = b;
+
+        // Retrace, within a stroke
+        if(graph->distance[a][b] != UINT32_MAX)
+        {
+            pairing->kind[slot] = PAIR_RETRACE;
+            searchPairings(graph, odd, oddCount, paired, pairing, cost + graph->distance[a][b], best);
+        }
+
+        // Blanked move
+        pairing->kind[slot] = PAIR_BLANK;
+        searchPairings(graph, odd, oddCount, paired, pairing, cost + blankCost(graph->vertices[a], graph->vertices[b]), best);
+
+        // Ends of the path, in either direction
+        if(pairing->start == -1)
+        {
+            pairing->kind[slot] = PAIR_OPEN;
+            pairing->start = a;
+            pairing->end   = b;
+            searchPairings(graph, odd, oddCount, paired, pairing, cost, best);
+            pairing->start = b;
+            pairing->end   = a;
+            searchPairings(graph, odd, oddCount, paired, pairing, cost, best);
+            pairing->start = -1;
+            pairing->end   = -1;
+        }
+
+        --pairing->count;
+        paired[index] = false;
+    }
+    paired[first] = false;
+}
+
+// Search Traversal
+// - Finds the cheapest pairing of the odd vertices of the graph.
+struct result searchTraversal(struct graph* graph)
+{
+    struct result best =
+    {
+        .cost   = UINT32_MAX,
+        .breaks = 0,
+        .bias   = 0
+    };
+
+    int odd[VERTEX_MAX];
+    int oddCount = 0;
+    for(int vertex = 0; vertex < graph->vertexCount; ++vertex)
+    {
+        if(graph->degree[vertex] % 2 != 0) odd[oddCount++] = vertex;
+    }
+
+    if(oddCount > ODD_MAX)
+    {
+        fprintf(stderr, "Glyph exceeds %i odd vertices\n", ODD_MAX);
+        exit(1);
+    }
+
+    struct pairing pairing =
+    {
+        .count = 0,
+        .start = -1,
+        .end   = -1
+    };
+
+    if(oddCount != 0)
+    {
+        bool paired[ODD_MAX] = { false };
+        searchPairings(graph, odd, oddCount, paired, &pairing, 0, &best);
+        return best;
+    }
+
+    // Closed strokes only, the path may begin anywhere
+    for(int vertex = 0; vertex < graph->vertexCount; ++vertex)
+    {
+        pairing.start = vertex;
+        pairing.end   = vertex;
+
+        int      breaks;
+        uint32_t cost = searchSplice(graph, &pairing, &breaks, NULL);
+        searchKeep(&best, &pairing, cost, breaks, graph->vertices[vertex].x);
+    }
+
+    return best;
+}
+
+// Traversal ------------------------------------------------------------------------------------------------------------------
+
+// Trace Glyph
+// - Builds the path of the specified pairing (Hierholzer's algorithm) and outputs its points and breaks. Returns the number
+//   of points.
+uint16_t traceGlyph(struct graph* graph, struct pairing* pairing, xyPoint_t* points, uint16_t* breaks, uint16_t* breakCount)
+{
+    // Path graph: the segments, the retraces, and the moves between strokes
+    struct graph path = *graph;
+    int virtualVertex = graph->vertexCount;
+
+    for(int index = 0; index < pairing->count; ++index)
+    {
+        if(pairing->kind[index] != PAIR_RETRACE) continue;
+
+        for(int vertex = pairing->a[index]; vertex != pairing->b[index]; )
+        {
+            int next = graph->next[vertex][pairing->b[index]];
+            graphEdge(&path, vertex, next, EDGE_LIT);
+            vertex = next;
+        }
+    }
+
+    int spliceBreaks;
+    searchSplice(graph, pairing, &spliceBreaks, &path);
+
+    // Hierholzer, lit edges taken before blanked ones
+    bool used[EDGE_MAX] = { false };
+    int  stack[EDGE_MAX + 1];
+    int  stackEdges[EDGE_MAX + 1];
+    int  top = 0;
+    int  circuit[EDGE_MAX + 1];
+    int  circuitEdges[EDGE_MAX + 1];
+    int  length = 0;
+
+    stack[top]      = virtualVertex;
+    stackEdges[top] = -1;
+    ++top;
+
+    while(top != 0)
+    {
+        int vertex = stack[top - 1];
+        int chosen = -1;
+
+        for(int pass = EDGE_LIT; pass <= EDGE_VIRTUAL && chosen == -1; ++pass)
+        {
+            for(int edge = 0; edge < path.edgeCount && chosen == -1; ++edge)
+            {
+                struct edge* e = &path.edges[edge];
+                if(used[edge] || (int)e->kind != pass) continue;
+                if(e->a == vertex || e->b == vertex) chosen = edge;
+            }
+        }
+
+        if(chosen == -1)
+        {
+            --top;
+            circuit[length]      = stack[top];
+            circuitEdges[length] = stackEdges[top];
+            ++length;
+            continue;
+        }
+
+        used[chosen] = true;
+        struct edge* e = &path.edges[chosen];
+        stack[top]      = e->a == vertex ? e->b : e->a;
+        stackEdges[top] = chosen;
+        ++top;
+    }
+
+    // Circuit is reversed, from and to the virtual vertex. The edge of each entry leads into it from the next.
+    uint16_t count = 0;
+    bool     lit[EDGE_MAX + 1];
+    *breakCount = 0;
+    for(int index = length - 2; index >= 1; --index)
+    {
+        xyPoint_t     point = graph->vertices[circuit[index]];
+        enum edgeKind kind  = path.edges[circuitEdges[index]].kind;
+
+        // Points the glyph did not stop at are passed through
+        if(kind == EDGE_LIT && count >= 2 && lit[count - 1] && graphSpanned(graph, points[count - 2], points[count - 1], point))
+        {
+            points[count - 1] = point;
+            continue;
+        }
+
+        if(kind == EDGE_BLANK && count != 0) breaks[(*breakCount)++] = count;
+
+        lit[count]      = kind == EDGE_LIT;
+        points[count++] = point;
+    }
+
+    return count;
+}
+
+// Output ---------------------------------------------------------------------------------------------------------------------
+
+// Print Section
+// - Outputs a section header, padded with dashes to the line width.
+void printSection(const char* name)
+{
+    int length = printf("// %s ", name);
+    for(; length < 127; ++length) printf("-");
+    printf("\n");
+}
+
+void printPoints(xyPoint_t* points, uint16_t count)
+{
+    printf("{\n    ");
+    for(uint16_t index = 0; index < count; ++index)
+    {
+        if(index % 8 == 0 && index != 0) printf("\n    ");
+        else if(index != 0) printf(" ");
+        printf("{0x%02X, 0x%02X}", points[index].x, points[index].y);
+        if(index != count - 1) printf(",");
+    }
+    printf("\n};\n\n");
+}
+
+void printBreaks(uint16_t* breaks, uint16_t count)
+{
+    printf("{\n    ");
+    for(uint16_t index = 0; index < count; ++index)
+    {
+        printf("%i", breaks[index]);
+        if(index != count - 1) printf(", ");
+    }
+    printf("\n};\n\n");
+}
+
+// Print Table
+// - Outputs an array of 128 entries, 4 per line. Each entry is named by the format and the glyph its arrays are taken from,
+//   or is the empty value if the glyph has no breaks (when break counts are specified).
+void printTable(const char* declaration, const char* format, const char* empty, int* source, uint16_t* breakCounts)
+{
+    printf("%s\n{\n", declaration);
+
+    for(int index = 0; index < GLYPH_COUNT; ++index)
+    {
+        if(index % 4 == 0) printf("    ");
+
+        if(breakCounts != NULL && breakCounts[source[index]] == 0) printf("%s", empty);
+        else printf(format, source[index]);
+
+        if(index != GLYPH_COUNT - 1) printf(",");
+        printf(index % 4 == 3 ? "\n" : " ");
+        if(index % 16 == 15 && index != GLYPH_COUNT - 1) printf("\n");
+    }
+
+    printf("};\n");
+}
+
+// Entrypoint -----------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    for(int index = 1; index < argc; ++index)
+    {
+        if(strcmp(argv[index], "-p") == 0 && index + 1 < argc)
+        {
+            retracePenalty = atoi(argv[++index]);
+            continue;
+        }
+
+        fprintf(stderr, "Usage: %s [-p <us>] > xy_shapes.c\n", argv[0]);
+        return 1;
+    }
+
+    xySetupRcTiming(RC_CONSTANT_US, RC_PIXEL_THRES);
+    xySetupRgbzDelay(Z_DELAY_US);
+
+    // Glyphs sharing a point array are output once, as the first of them
+    int source[GLYPH_COUNT];
+    for(int index = 0; index < GLYPH_COUNT; ++index)
+    {
+        source[index] = index;
+        for(int other = 0; other < index; ++other)
+        {
+            if(xyShape16x16Ascii[other] == xyShape16x16Ascii[index])
+            {
+                source[index] = other;
+                break;
+            }
+        }
+    }
+
+    static xyPoint_t points[GLYPH_COUNT][EDGE_MAX + 1];
+    static uint16_t  breaks[GLYPH_COUNT][EDGE_MAX];
+    uint16_t         pointCounts[GLYPH_COUNT] = { 0 };
+    uint16_t         breakCounts[GLYPH_COUNT] = { 0 };
+
+    fprintf(stderr, "# Glyph strokes, before and after (')\n");
+    fprintf(stderr, "%-6s %8s %8s %8s %8s %8s %10s %10s\n", "glyph", "points", "points'", "breaks'", "retrace", "retrace'",
+        "draw_us", "draw_us'");
+
+    uint32_t pointsBefore  = 0;
+    uint32_t pointsAfter   = 0;
+    uint32_t retraceBefore = 0;
+    uint32_t retraceAfter  = 0;
+    double   timeBefore    = 0;
+    double   timeAfter     = 0;
+    double   strokeBefore  = 0;          // Draw time of the glyphs of a single stroke.
+    double   strokeAfter   = 0;
+
+    for(int glyph = 0; glyph < GLYPH_COUNT; ++glyph)
+    {
+        if(source[glyph] != glyph || xyShape16x16Ascii[glyph] == NULL) continue;
+
+        xyPoint_t*      original           = xyShape16x16Ascii[glyph];
+        uint16_t        originalCount      = xyShapeSize16x16Ascii[glyph];
+        const uint16_t* originalBreaks     = xyShapeBreaks16x16Ascii[glyph];
+        uint16_t        originalBreakCount = xyShapeBreakCount16x16Ascii[glyph];
+
+        struct graph graph;
+        int traced = graphBuild(&graph, NULL, glyph, original, originalCount, originalBreaks, originalBreakCount);
+        graphAnalyze(&graph);
+
+        struct result result = searchTraversal(&graph);
+        pointCounts[glyph] = traceGlyph(&graph, &result.pairing, points[glyph], breaks[glyph], &breakCounts[glyph]);
+
+        // Every segment must be drawn, and nothing else
+        struct graph check;
+        int retraced = graphBuild(&check, &graph, glyph, points[glyph], pointCounts[glyph], breaks[glyph],
+            breakCounts[glyph]);
+        bool valid = check.edgeCount == graph.edgeCount;
+        for(int edge = 0; valid && edge < graph.edgeCount; ++edge)
+        {
+            xyPoint_t a = graph.vertices[graph.edges[edge].a];
+            xyPoint_t b = graph.vertices[graph.edges[edge].b];
+
+            bool found = false;
+            for(int other = 0; other < check.edgeCount && !found; ++other)
+            {
+                xyPoint_t c = check.vertices[check.edges[other].a];
+                xyPoint_t d = check.vertices[check.edges[other].b];
+                found = (a.x == c.x && a.y == c.y && b.x == d.x && b.y == d.y) ||
+                    (a.x == d.x && a.y == d.y && b.x == c.x && b.y == c.y);
+            }
+
+            valid = found;
+        }
+
+        if(!valid)
+        {
+            fprintf(stderr, "Traversal of glyph 0x%02X does not match its segments\n", glyph);
+            return 1;
+        }
+
+        double before = drawTimeUs(original, originalCount, originalBreaks, originalBreakCount);
+        double after  = drawTimeUs(points[glyph], pointCounts[glyph], breaks[glyph], breakCounts[glyph]);
+
+        char name[8];
+        if(glyph > 0x20 && glyph < 0x7F) snprintf(name, sizeof(name), "'%c'", glyph);
+        else snprintf(name, sizeof(name), "0x%02X", glyph);
+
+        fprintf(stderr, "%-6s %8i %8i %8i %8i %8i %10.1f %10.1f\n", name, originalCount, pointCounts[glyph],
+            breakCounts[glyph], traced - graph.edgeCount, retraced - graph.edgeCount, before, after);
+
+        pointsBefore  += originalCount;
+        pointsAfter   += pointCounts[glyph];
+        retraceBefore += traced - graph.edgeCount;
+        retraceAfter  += retraced - graph.edgeCount;
+        timeBefore    += before;
+        timeAfter     += after;
+
+        if(breakCounts[glyph] == 0)
+        {
+            strokeBefore += before;
+            strokeAfter  += after;
+        }
+    }
+
+    fprintf(stderr, "%-6s %8u %8u %8s %8u %8u %10.1f %10.1f\n", "total", pointsBefore, pointsAfter, "", retraceBefore,
+        retraceAfter, timeBefore, timeAfter);
+    fprintf(stderr, "single stroke glyphs: draw time %.1f%% less\n", 100.0 * (strokeBefore - strokeAfter) / strokeBefore);
+    fprintf(stderr, "all glyphs: draw time %+.1f%%, %+i points\n", 100.0 * (timeAfter - timeBefore) / timeBefore,
+        (int)pointsAfter - (int)pointsBefore);
+
+    // Tables
+    printf("// Header\n#include \"xy_shapes.h\"\n\n");
+    printSection("Primatives");
+    printf("\n");
+    printf("struct xyPoint* const xyShapeNull = NULL;\n\n");
+    printf("struct xyPoint xyShapePoint[XY_SHAPE_SIZE_POINT] =\n{\n    {0x00, 0x00}\n};\n\n");
+    printSection("ASCII");
+    printf("// - Generated by 'tools/optimize_glyphs.c', see said file for details.\n\n");
+
+    for(int glyph = 0; glyph < GLYPH_COUNT; ++glyph)
+    {
+        if(source[glyph] != glyph) continue;
+
+        if(pointCounts[glyph] == 0)
+        {
+            printf("#define XY_SHAPE_SIZE_16X16_ASCII_0X%02X 0\n", glyph);
+            printf("struct xyPoint* const xyShape16x16Ascii0x%02X = NULL;\n\n", glyph);
+            continue;
+        }
+
+        printf("#define XY_SHAPE_SIZE_16X16_ASCII_0X%02X %i\n", glyph, pointCounts[glyph]);
+        printf("struct xyPoint xyShape16x16Ascii0x%02X[XY_SHAPE_SIZE_16X16_ASCII_0X%02X] =\n", glyph, glyph);
+        printPoints(points[glyph], pointCounts[glyph]);
+
+        if(breakCounts[glyph] == 0) continue;
+
+        printf("#define XY_SHAPE_BREAKS_16X16_ASCII_0X%02X %i\n", glyph, breakCounts[glyph]);
+        printf("const uint16_t xyShapeBreaks16x16Ascii0x%02X[XY_SHAPE_BREAKS_16X16_ASCII_0X%02X] =\n", glyph, glyph);
+        printBreaks(breaks[glyph], breakCounts[glyph]);
+    }
+
+    printTable("struct xyPoint* xyShape16x16Ascii[128] =", "xyShape16x16Ascii0x%02X", NULL, source, NULL);
+    printf("\n");
+    printTable("uint16_t xyShapeSize16x16Ascii[128] =", "XY_SHAPE_SIZE_16X16_ASCII_0X%02X", NULL, source, NULL);
+    printf("\n");
+    printTable("const uint16_t* xyShapeBreaks16x16Ascii[128] =", "xyShapeBreaks16x16Ascii0x%02X", "NULL", source, breakCounts);
+    printf("\n");
+    printTable("uint16_t xyShapeBreakCount16x16Ascii[128] =", "XY_SHAPE_BREAKS_16X16_ASCII_0X%02X", "0", source, breakCounts);
+
+    return 0;
+}